@@ -0,0 +1,47 @@
+#!/bin/sh
+# Stress test of the shared compiled programs: the programs of tests/batch are run <copies> times each by --batch on <threads> threads,
+# in one process, and each outcome must be the one of tests/batch/expected.txt
+# The batch runs without the cache (every copy compiled by a worker), twice with a fresh cache (written then loaded concurrently) and with --jit
+# usage: sh ./scripts/linux-test-batch.sh [entropia binary] [threads] [copies]
+
+ENTROPIA=${1:-./build/daedalus-entropia/bin/run/DEBUG/Daedalus-Entropia.exe}
+THREADS=${2:-8}
+COPIES=${3:-100}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# The copies are interleaved, so the workers run different programs at the same time
+: > "$WORK/manifest"
+: > "$WORK/expected"
+i=0
+while [ "$i" -lt "$COPIES" ]; do
+    for program in ./tests/batch/*.ent; do
+        echo "$program" >> "$WORK/manifest"
+        grep -F "$program " ./tests/batch/expected.txt >> "$WORK/expected"
+    done
+    i=$((i + 1))
+done
+
+failures=0
+for pass in uncached cold warm jit; do
+    if [ "$pass" = "uncached" ]; then
+        ENTROPIA_CACHE=0 "$ENTROPIA" --threads "$THREADS" --manifest "$WORK/manifest" > "$WORK/output" 2>&1
+    elif [ "$pass" = "jit" ]; then
+        ENTROPIA_CACHE=0 "$ENTROPIA" --jit --threads "$THREADS" --manifest "$WORK/manifest" > "$WORK/output" 2>&1
+    else
+        ENTROPIA_CACHE_DIR="$WORK" "$ENTROPIA" --threads "$THREADS" --manifest "$WORK/manifest" > "$WORK/output" 2>&1
+    fi
+
+    # The outcomes only, without the results printed by the debug builds
+    grep -E '^\./tests/batch/[^ ]+\.ent (->|!!) ' "$WORK/output" > "$WORK/outcomes"
+    if cmp -s "$WORK/expected" "$WORK/outcomes"; then
+        echo "$pass ok ($(wc -l < "$WORK/outcomes") files)"
+    else
+        echo "$pass differs (< expected, > outcome)"
+        diff "$WORK/expected" "$WORK/outcomes" | head -20
+        failures=$((failures + 1))
+    fi
+done
+
+echo "$failures failed"
+[ "$failures" -eq 0 ]
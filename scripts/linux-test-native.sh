@@ -0,0 +1,31 @@
+#!/bin/sh
+# Differential test of the native backend: each program of tests/native is run by the interpreter and with --native,
+# their results (printed by the debug builds), errors and exit codes must be the same
+# usage: sh ./scripts/linux-test-native.sh [entropia debug binary]
+
+ENTROPIA=${1:-./build/daedalus-entropia/bin/run/DEBUG/Daedalus-Entropia.exe}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# The results and the error, without the debug dumps of the tokens and nodes
+run() {
+    ENTROPIA_CACHE_DIR="$WORK" "$ENTROPIA" "$@" > "$WORK/output" 2>&1
+    echo "exit $?"
+    grep -e " -> " -e "what():" "$WORK/output"
+}
+
+failures=0
+for program in ./tests/native/*.ent; do
+    run "$program" > "$WORK/interpreted"
+    run --native "$program" > "$WORK/native"
+    if cmp -s "$WORK/interpreted" "$WORK/native"; then
+        echo "$program ok"
+    else
+        echo "$program differs (< interpreter, > native)"
+        diff "$WORK/interpreted" "$WORK/native"
+        failures=$((failures + 1))
+    fi
+done
+
+echo "$failures failed"
+[ "$failures" -eq 0 ]
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Differential test of the optimizer: each program of tests/optimizer is run with ENTROPIA_OPTIMIZE=0 and optimized
+# (interpreted, streamed, pipelined and native), its results (printed by the debug builds), errors and exit codes must be the same
+# usage: sh ./scripts/linux-test-optimizer.sh [entropia debug binary]
+
+ENTROPIA=${1:-./build/daedalus-entropia/bin/run/DEBUG/Daedalus-Entropia.exe}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# The results and the error, without the debug dumps of the tokens and nodes
+run() {
+    ENTROPIA_CACHE=0 "$ENTROPIA" "$@" > "$WORK/output" 2>&1
+    echo "exit $?"
+    grep -e " -> " -e "what():" "$WORK/output"
+}
+
+failures=0
+for program in ./tests/optimizer/*.ent; do
+    ENTROPIA_OPTIMIZE=0 run "$program" > "$WORK/unoptimized"
+    for mode in "" --stream --pipeline --native; do
+        run $mode "$program" > "$WORK/optimized"
+        if cmp -s "$WORK/unoptimized" "$WORK/optimized"; then
+            echo "$program $mode ok"
+        else
+            echo "$program $mode differs (< unoptimized, > optimized)"
+            diff "$WORK/unoptimized" "$WORK/optimized"
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+echo "$failures failed"
+[ "$failures" -eq 0 ]
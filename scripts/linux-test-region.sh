@@ -0,0 +1,30 @@
+#!/bin/sh
+# Bounded memory of the loop regions: each program of tests/region is run with its iterations (first line) as written and
+# multiplied by 1000, the peak rss (--stats) of the long run must stay within a chunk budget of the short one
+# usage: sh ./scripts/linux-test-region.sh [entropia binary] [budget in KiB]
+
+ENTROPIA=${1:-./build/daedalus-entropia/bin/run/DEBUG/Daedalus-Entropia.exe}
+BUDGET=${2:-1024}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# The peak rss of a run, in KiB
+peak() {
+    ENTROPIA_CACHE=0 "$ENTROPIA" --stats "$1" 2>&1 | grep "peak rss" | tr -s ' ' | cut -d ' ' -f 3
+}
+
+failures=0
+for program in ./tests/region/*.ent; do
+    sed '1s/= \([0-9]*\);/= \1000;/' "$program" > "$WORK/long.ent"
+    short=$(peak "$program")
+    long=$(peak "$WORK/long.ent")
+    if [ -n "$short" ] && [ -n "$long" ] && [ "$long" -le $((short + BUDGET)) ]; then
+        echo "$program ok ($short KiB, $long KiB)"
+    else
+        echo "$program grows ($short KiB, $long KiB)"
+        failures=$((failures + 1))
+    fi
+done
+
+echo "$failures failed"
+[ "$failures" -eq 0 ]
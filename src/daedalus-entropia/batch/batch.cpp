@@ -0,0 +1,109 @@
+#include <daedalus/Entropia/batch/batch.hpp>
+
+#include <fstream>
+#include <future>
+
+std::vector<std::string> daedalus::entropia::batch::read_manifest(std::string path) {
+	std::ifstream file = std::ifstream(path);
+	DAE_ASSERT_TRUE(
+		file.is_open(),
+		std::runtime_error("Can't open the manifest " + path)
+	)
+
+	auto filenames = std::vector<std::string>();
+	std::string line;
+	while(std::getline(file, line)) {
+		size_t start = line.find_first_not_of(" \t\r");
+		if(start == std::string::npos || line.at(start) == '#') {
+			continue;
+		}
+		size_t end = line.find_last_not_of(" \t\r");
+		filenames.push_back(line.substr(start, end - start + 1));
+	}
+	return filenames;
+}
+
+daedalus::entropia::batch::FileResult daedalus::entropia::batch::run_file(std::string filename, bool recordResults) {
+	daedalus::entropia::batch::FileResult fileResult = daedalus::entropia::batch::FileResult();
+	fileResult.filename = filename;
+
+	try {
+		DAE_ASSERT_TRUE(
+			filename.rfind(".ent") != std::string::npos,
+			std::runtime_error("Invalid file format")
+		)
+
+		daedalus::entropia::source::SourceFile source = daedalus::entropia::source::SourceFile(filename);
+
+		bool useCache = daedalus::entropia::cache::is_cache_enabled();
+		uint64_t sourceHash = daedalus::entropia::cache::hash_source(source.get_view());
+		std::string cachePath = daedalus::entropia::cache::get_cache_path(filename, sourceHash);
+
+		std::shared_ptr<daedalus::core::ast::Scope> cachedProgram = useCache ?
+			daedalus::entropia::cache::load_program(cachePath, sourceHash) :
+			nullptr;
+
+		std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program = cachedProgram != nullptr ?
+			std::make_shared<const daedalus::entropia::program::CompiledProgram>(cachedProgram) :
+			std::make_shared<const daedalus::entropia::program::CompiledProgram>(source.to_string());
+
+		if(useCache && cachedProgram == nullptr) {
+			try {
+				daedalus::entropia::cache::save_program(cachePath, sourceHash, program->get_program());
+			} catch(const std::exception& error) {
+				DAE_DEBUG_LOG(std::string("CACHE ") + error.what())
+			}
+		}
+
+		auto lazyResults = std::vector<daedalus::entropia::interpreter::LazyResult>();
+		std::shared_ptr<daedalus::core::values::RuntimeValue> value = daedalus::entropia::program::ExecutionContext(program).run(
+			recordResults ? &lazyResults : nullptr
+		);
+
+		// Formatted by the worker, the printing thread only writes
+		fileResult.value = value != nullptr ? value->repr() : daedalus::entropia::values::get_null()->repr();
+		for(const daedalus::entropia::interpreter::LazyResult& lazyResult : lazyResults) {
+			fileResult.results.push_back(lazyResult.get());
+		}
+	} catch(const std::exception& error) {
+		fileResult.error = error.what();
+	}
+
+	return fileResult;
+}
+
+size_t daedalus::entropia::batch::run_batch(std::vector<std::string> filenames, size_t threadCount, bool recordResults, std::ostream& output) {
+	auto promises = std::vector<std::promise<daedalus::entropia::batch::FileResult>>(filenames.size());
+	auto futures = std::vector<std::future<daedalus::entropia::batch::FileResult>>();
+	for(std::promise<daedalus::entropia::batch::FileResult>& promise : promises) {
+		futures.push_back(promise.get_future());
+	}
+
+	// Set up once before the workers share it
+	(void)daedalus::entropia::program::get_daedalus();
+
+	daedalus::entropia::pool::WorkStealingPool pool = daedalus::entropia::pool::WorkStealingPool(
+		threadCount,
+		filenames.size(),
+		[&filenames, &promises, recordResults](size_t i) {
+			promises.at(i).set_value(daedalus::entropia::batch::run_file(filenames.at(i), recordResults));
+		}
+	);
+
+	size_t failures = 0;
+	for(std::future<daedalus::entropia::batch::FileResult>& future : futures) {
+		daedalus::entropia::batch::FileResult fileResult = future.get();
+		if(!fileResult.error.empty()) {
+			output << fileResult.filename << " !! " << fileResult.error << "\n";
+			failures++;
+			continue;
+		}
+		for(const auto& [node, result] : fileResult.results) {
+			output << "\t" << node << " -> " << result << "\n";
+		}
+		output << fileResult.filename << " -> " << fileResult.value << "\n";
+	}
+	output.flush();
+
+	return failures;
+}
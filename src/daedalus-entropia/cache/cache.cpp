@@ -0,0 +1,564 @@
+#include <daedalus/Entropia/cache/cache.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct CacheBuffers {
+	std::vector<daedalus::entropia::cache::NodeRecord> nodes;
+	std::vector<uint32_t> lists;
+	std::string strings;
+	// The shared nodes are written once
+	std::unordered_map<daedalus::core::ast::Expression*, uint32_t> written;
+};
+
+static uint32_t write_record(CacheBuffers& buffers, daedalus::entropia::cache::NodeKind kind, uint32_t flags = 0, std::vector<uint32_t> operands = {}, double number = 0) {
+	daedalus::entropia::cache::NodeRecord record = daedalus::entropia::cache::NodeRecord{ kind, flags, { 0, 0, 0, 0, 0, 0, 0, 0 }, number };
+	for(size_t i = 0; i < operands.size(); i++) {
+		record.operands[i] = operands.at(i);
+	}
+	buffers.nodes.push_back(record);
+	return static_cast<uint32_t>(buffers.nodes.size() - 1);
+}
+
+static std::vector<uint32_t> write_string(CacheBuffers& buffers, std::string value) {
+	uint32_t offset = static_cast<uint32_t>(buffers.strings.size());
+	buffers.strings += value;
+	return { offset, static_cast<uint32_t>(value.size()) };
+}
+
+static std::vector<uint32_t> concat_operands(std::vector<uint32_t> operands, std::vector<uint32_t> others) {
+	operands.insert(operands.end(), others.begin(), others.end());
+	return operands;
+}
+
+static uint32_t write_node(CacheBuffers& buffers, std::shared_ptr<daedalus::core::ast::Expression> expression);
+
+static std::vector<uint32_t> write_list(CacheBuffers& buffers, std::vector<std::shared_ptr<daedalus::core::ast::Expression>> expressions) {
+	auto indices = std::vector<uint32_t>();
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : expressions) {
+		indices.push_back(write_node(buffers, expression));
+	}
+	uint32_t offset = static_cast<uint32_t>(buffers.lists.size());
+	buffers.lists.insert(buffers.lists.end(), indices.begin(), indices.end());
+	return { offset, static_cast<uint32_t>(indices.size()) };
+}
+
+static uint32_t write_node_record(CacheBuffers& buffers, std::shared_ptr<daedalus::core::ast::Expression> expression);
+
+static uint32_t write_node(CacheBuffers& buffers, std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(expression == nullptr) {
+		return daedalus::entropia::cache::NO_NODE;
+	}
+
+	auto writtenNode = buffers.written.find(expression.get());
+	if(writtenNode != buffers.written.end()) {
+		return writtenNode->second;
+	}
+
+	uint32_t index = write_node_record(buffers, expression);
+	buffers.written[expression.get()] = index;
+	return index;
+}
+
+static uint32_t write_for_record(CacheBuffers& buffers, std::shared_ptr<daedalus::entropia::ast::ForExpression> forExpression) {
+	std::vector<uint32_t> body = write_list(buffers, forExpression->get_body());
+	uint32_t initialExpression = write_node(buffers, forExpression->get_initial_expression());
+	uint32_t condition = write_node(buffers, forExpression->get_condition());
+	uint32_t updateExpression = write_node(buffers, forExpression->get_update_expression());
+	uint32_t orExpression = write_node(buffers, forExpression->get_or_expression());
+	return write_record(buffers, daedalus::entropia::cache::NodeKind::FOR, 0, concat_operands({ body.at(0), body.at(1), initialExpression, condition, updateExpression, orExpression }, write_string(buffers, forExpression->get_static_type())));
+}
+
+static uint32_t write_node_record(CacheBuffers& buffers, std::shared_ptr<daedalus::core::ast::Expression> expression) {
+
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::NUMBER, 0, {}, std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)->get_value());
+	}
+	if(type == "BooleanExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::BOOLEAN, std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)->get_value());
+	}
+	if(type == "CharExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::CHAR, static_cast<unsigned char>(std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(expression)->get_value()));
+	}
+	if(type == "StrExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::STR, 0, write_string(buffers, std::dynamic_pointer_cast<daedalus::entropia::ast::StrExpression>(expression)->get_value()));
+	}
+	if(type == "Identifier") {
+		auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression);
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::IDENTIFIER, 0, concat_operands(write_string(buffers, identifier->get_name()), write_string(buffers, identifier->get_static_type())));
+	}
+	if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		uint32_t term = write_node(buffers, unaryExpression->get_term());
+		std::vector<uint32_t> symbol = write_string(buffers, unaryExpression->get_operator_symbol());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::UNARY, 0, concat_operands({ term, symbol.at(0), symbol.at(1) }, write_string(buffers, unaryExpression->get_static_type())));
+	}
+	if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		uint32_t left = write_node(buffers, binaryExpression->get_left());
+		uint32_t right = write_node(buffers, binaryExpression->get_right());
+		std::vector<uint32_t> symbol = write_string(buffers, binaryExpression->get_operator_symbol());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::BINARY, 0, concat_operands({ left, right, symbol.at(0), symbol.at(1) }, write_string(buffers, binaryExpression->get_static_type())));
+	}
+	if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		uint32_t identifier = write_node(buffers, declarationExpression->get_identifier());
+		uint32_t value = write_node(buffers, declarationExpression->get_value());
+		std::vector<uint32_t> valueType = write_string(buffers, declarationExpression->get_value_type());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::DECLARATION, (declarationExpression->get_mutability() ? daedalus::entropia::cache::DECLARATION_MUTABLE : 0) | (declarationExpression->get_hidden() ? daedalus::entropia::cache::DECLARATION_HIDDEN : 0), { identifier, value, valueType.at(0), valueType.at(1) });
+	}
+	if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		uint32_t identifier = write_node(buffers, assignationExpression->get_identifier());
+		uint32_t value = write_node(buffers, assignationExpression->get_value());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::ASSIGNATION, 0, concat_operands({ identifier, value }, write_string(buffers, assignationExpression->get_static_type())));
+	}
+	if(type == "OrExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::OR, 0, { write_node(buffers, std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression)->get_value()) });
+	}
+	if(type == "LoopExpression") {
+		auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression);
+		std::vector<uint32_t> body = write_list(buffers, loopExpression->get_body());
+		uint32_t orExpression = write_node(buffers, loopExpression->get_or_expression());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::LOOP, 0, concat_operands({ body.at(0), body.at(1), orExpression }, write_string(buffers, loopExpression->get_static_type())));
+	}
+	if(type == "WhileExpression") {
+		auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(expression);
+		std::vector<uint32_t> body = write_list(buffers, whileExpression->get_body());
+		uint32_t condition = write_node(buffers, whileExpression->get_condition());
+		uint32_t orExpression = write_node(buffers, whileExpression->get_or_expression());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::WHILE, 0, concat_operands({ body.at(0), body.at(1), condition, orExpression }, write_string(buffers, whileExpression->get_static_type())));
+	}
+	if(type == "ForExpression") {
+		return write_for_record(buffers, std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(expression));
+	}
+	if(type == "ParallelForExpression") {
+		auto parallelForExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ParallelForExpression>(expression);
+		// Only referenced by the PAR_FOR record, never shared
+		uint32_t forExpression = write_for_record(buffers, parallelForExpression);
+		std::string reductions = "";
+		for(const daedalus::entropia::ast::Reduction& reduction : parallelForExpression->get_reductions()) {
+			reductions += (reductions.empty() ? "" : ",") + reduction.name + ":" + reduction.operator_symbol;
+		}
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::PAR_FOR, 0, concat_operands({ forExpression }, write_string(buffers, reductions)));
+	}
+	if(type == "BreakExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::BREAK);
+	}
+	if(type == "ContinueExpression") {
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::CONTINUE);
+	}
+	if(type == "ConditionnalStructure") {
+		auto conditionnalStructure = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression);
+		auto expressions = std::vector<uint32_t>();
+		uint32_t before = daedalus::entropia::cache::NO_NODE;
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : conditionnalStructure->get_expressions()) {
+			std::vector<uint32_t> body = write_list(buffers, conditionnalExpression->get_body());
+			uint32_t condition = write_node(buffers, conditionnalExpression->get_condition());
+			before = write_record(buffers, daedalus::entropia::cache::NodeKind::CONDITIONNAL_EXPRESSION, 0, { body.at(0), body.at(1), condition, before });
+			expressions.push_back(before);
+		}
+		uint32_t offset = static_cast<uint32_t>(buffers.lists.size());
+		buffers.lists.insert(buffers.lists.end(), expressions.begin(), expressions.end());
+		return write_record(buffers, daedalus::entropia::cache::NodeKind::CONDITIONNAL_STRUCTURE, 0, concat_operands({ offset, static_cast<uint32_t>(expressions.size()) }, write_string(buffers, conditionnalStructure->get_static_type())));
+	}
+
+	throw std::runtime_error("Trying to cache unsupported node " + type);
+}
+
+uint64_t daedalus::entropia::cache::hash_source(std::string_view src) {
+	uint64_t hash = 14695981039346656037ULL;
+	for(char c : src) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+std::string daedalus::entropia::cache::get_cache_path(std::string filename, uint64_t hash) {
+	const char* cacheDirectory = std::getenv("ENTROPIA_CACHE_DIR");
+	if(cacheDirectory == nullptr || std::string(cacheDirectory).empty()) {
+		return filename + "c";
+	}
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.entc", static_cast<unsigned long long>(hash));
+	return std::string(cacheDirectory) + "/" + name;
+}
+
+#ifndef _WIN32
+static bool write_all(int fd, const char* data, size_t size) {
+	while(size > 0) {
+		ssize_t written = ::write(fd, data, size);
+		if(written < 0 && errno == EINTR) {
+			continue;
+		}
+		if(written <= 0) {
+			return false;
+		}
+		data += written;
+		size -= static_cast<size_t>(written);
+	}
+	return true;
+}
+#endif
+
+bool daedalus::entropia::cache::is_cache_enabled() {
+	const char* cache = std::getenv("ENTROPIA_CACHE");
+	// A cache file holds an optimized program
+	return (cache == nullptr || std::string(cache) != "0") && daedalus::entropia::optimizer::is_optimizer_enabled();
+}
+
+void daedalus::entropia::cache::save_program(std::string path, uint64_t hash, std::shared_ptr<daedalus::core::ast::Scope> program) {
+	CacheBuffers buffers = CacheBuffers();
+
+	std::vector<uint32_t> programBody = write_list(buffers, program->get_body());
+
+	daedalus::entropia::cache::CacheHeader header = daedalus::entropia::cache::CacheHeader{
+		{ 'E', 'N', 'T', 'C' },
+		daedalus::entropia::cache::CACHE_VERSION,
+		hash,
+		static_cast<uint32_t>(buffers.nodes.size()),
+		static_cast<uint32_t>(buffers.lists.size()),
+		static_cast<uint32_t>(buffers.strings.size()),
+		programBody.at(0),
+		programBody.at(1),
+		0x01020304
+	};
+
+	// Written in a temporary file of its own then renamed, so a concurrent run never maps a partial cache and two writers of a hash never share a file
+#ifndef _WIN32
+	std::string temporaryPath = path + ".XXXXXX";
+	int fd = ::mkstemp(temporaryPath.data());
+	DAE_ASSERT_TRUE(
+		fd >= 0,
+		std::runtime_error("Can't write cache file " + path)
+	)
+	(void)::fchmod(fd, 0644);
+
+	bool isWritten = write_all(fd, reinterpret_cast<const char*>(&header), sizeof(header))
+		&& write_all(fd, reinterpret_cast<const char*>(buffers.nodes.data()), buffers.nodes.size() * sizeof(daedalus::entropia::cache::NodeRecord))
+		&& write_all(fd, reinterpret_cast<const char*>(buffers.lists.data()), buffers.lists.size() * sizeof(uint32_t))
+		&& write_all(fd, buffers.strings.data(), buffers.strings.size());
+	isWritten = ::close(fd) == 0 && isWritten;
+#else
+	std::string temporaryPath = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+	std::ofstream file = std::ofstream(temporaryPath, std::ios::binary | std::ios::trunc);
+	DAE_ASSERT_TRUE(
+		file.is_open(),
+		std::runtime_error("Can't write cache file " + path)
+	)
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(buffers.nodes.data()), buffers.nodes.size() * sizeof(daedalus::entropia::cache::NodeRecord));
+	file.write(reinterpret_cast<const char*>(buffers.lists.data()), buffers.lists.size() * sizeof(uint32_t));
+	file.write(buffers.strings.data(), buffers.strings.size());
+	file.close();
+	bool isWritten = !file.fail();
+#endif
+
+	if(!isWritten || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+		(void)std::remove(temporaryPath.c_str());
+		throw std::runtime_error("Can't write cache file " + path);
+	}
+}
+
+static std::shared_ptr<daedalus::entropia::ast::Identifier> get_identifier(std::vector<std::shared_ptr<daedalus::core::ast::Expression>>& nodes, uint32_t index) {
+	auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(nodes.at(index));
+	DAE_ASSERT_TRUE(
+		identifier != nullptr,
+		std::runtime_error("Invalid cache: expected identifier")
+	)
+	return identifier;
+}
+
+static std::shared_ptr<daedalus::entropia::ast::OrExpression> get_or_expression(std::vector<std::shared_ptr<daedalus::core::ast::Expression>>& nodes, uint32_t index) {
+	return index == daedalus::entropia::cache::NO_NODE ? nullptr : std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(nodes.at(index));
+}
+
+static std::shared_ptr<daedalus::core::ast::Scope> read_program(const char* data, size_t size, uint64_t hash) {
+	if(size < sizeof(daedalus::entropia::cache::CacheHeader)) {
+		return nullptr;
+	}
+
+	daedalus::entropia::cache::CacheHeader header;
+	std::memcpy(&header, data, sizeof(header));
+
+	if(
+		std::memcmp(header.magic, "ENTC", 4) != 0 ||
+		header.version != daedalus::entropia::cache::CACHE_VERSION ||
+		header.byteOrder != 0x01020304 ||
+		header.hash != hash
+	) {
+		return nullptr;
+	}
+
+	size_t nodesOffset = sizeof(header);
+	size_t listsOffset = nodesOffset + static_cast<size_t>(header.nodeCount) * sizeof(daedalus::entropia::cache::NodeRecord);
+	size_t stringsOffset = listsOffset + static_cast<size_t>(header.listSize) * sizeof(uint32_t);
+
+	DAE_ASSERT_TRUE(
+		stringsOffset + header.stringPoolSize == size,
+		std::runtime_error("Invalid cache: truncated file")
+	)
+
+	const auto* records = reinterpret_cast<const daedalus::entropia::cache::NodeRecord*>(data + nodesOffset);
+	const auto* lists = reinterpret_cast<const uint32_t*>(data + listsOffset);
+	const char* strings = data + stringsOffset;
+
+	auto nodes = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>(header.nodeCount);
+
+	auto get_node = [&nodes](uint32_t index, uint32_t current) -> std::shared_ptr<daedalus::core::ast::Expression> {
+		if(index == daedalus::entropia::cache::NO_NODE) {
+			return nullptr;
+		}
+		DAE_ASSERT_TRUE(
+			index < current,
+			std::runtime_error("Invalid cache: forward node reference")
+		)
+		return nodes.at(index);
+	};
+	auto get_list = [&header, &lists, &get_node](uint32_t offset, uint32_t count, uint32_t current) -> std::vector<std::shared_ptr<daedalus::core::ast::Expression>> {
+		DAE_ASSERT_TRUE(
+			static_cast<size_t>(offset) + count <= header.listSize,
+			std::runtime_error("Invalid cache: list out of bounds")
+		)
+		auto expressions = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+		expressions.reserve(count);
+		for(uint32_t i = 0; i < count; i++) {
+			expressions.push_back(get_node(lists[offset + i], current));
+		}
+		return expressions;
+	};
+	auto get_string = [&header, &strings](uint32_t offset, uint32_t length) -> std::string {
+		DAE_ASSERT_TRUE(
+			static_cast<size_t>(offset) + length <= header.stringPoolSize,
+			std::runtime_error("Invalid cache: string out of bounds")
+		)
+		return std::string(strings + offset, length);
+	};
+
+	for(uint32_t i = 0; i < header.nodeCount; i++) {
+		daedalus::entropia::cache::NodeRecord record;
+		std::memcpy(&record, records + i, sizeof(record));
+		const uint32_t* operands = record.operands;
+
+		switch(record.kind) {
+			case daedalus::entropia::cache::NodeKind::NUMBER:
+				nodes.at(i) = std::make_shared<daedalus::core::ast::NumberExpression>(record.number);
+				break;
+			case daedalus::entropia::cache::NodeKind::BOOLEAN:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::BooleanExpression>(record.flags != 0);
+				break;
+			case daedalus::entropia::cache::NodeKind::CHAR:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::CharExpression>(static_cast<char>(record.flags));
+				break;
+			case daedalus::entropia::cache::NodeKind::STR:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::StrExpression>(get_string(operands[0], operands[1]));
+				break;
+			case daedalus::entropia::cache::NodeKind::IDENTIFIER: {
+				auto identifier = std::make_shared<daedalus::entropia::ast::Identifier>(get_string(operands[0], operands[1]));
+				identifier->set_static_type(get_string(operands[2], operands[3]));
+				nodes.at(i) = identifier;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::UNARY: {
+				auto unaryExpression = std::make_shared<daedalus::entropia::ast::UnaryExpression>(
+					get_node(operands[0], i),
+					get_string(operands[1], operands[2])
+				);
+				unaryExpression->set_static_type(get_string(operands[3], operands[4]));
+				nodes.at(i) = unaryExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::BINARY: {
+				auto binaryExpression = std::make_shared<daedalus::entropia::ast::BinaryExpression>(
+					get_node(operands[0], i),
+					get_string(operands[2], operands[3]),
+					get_node(operands[1], i)
+				);
+				binaryExpression->set_static_type(get_string(operands[4], operands[5]));
+				nodes.at(i) = binaryExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::ASSIGNATION: {
+				auto assignationExpression = std::make_shared<daedalus::entropia::ast::AssignationExpression>(
+					get_identifier(nodes, operands[0]),
+					get_node(operands[1], i)
+				);
+				assignationExpression->set_static_type(get_string(operands[2], operands[3]));
+				nodes.at(i) = assignationExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::DECLARATION: {
+				auto declarationExpression = std::make_shared<daedalus::entropia::ast::DeclarationExpression>(
+					get_identifier(nodes, operands[0]),
+					get_node(operands[1], i),
+					get_string(operands[2], operands[3]),
+					(record.flags & daedalus::entropia::cache::DECLARATION_MUTABLE) != 0,
+					(record.flags & daedalus::entropia::cache::DECLARATION_HIDDEN) != 0
+				);
+				declarationExpression->set_static_type(declarationExpression->get_value_type());
+				nodes.at(i) = declarationExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::OR:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::OrExpression>(get_node(operands[0], i));
+				break;
+			case daedalus::entropia::cache::NodeKind::LOOP: {
+				auto loopExpression = std::make_shared<daedalus::entropia::ast::LoopExpression>(
+					get_list(operands[0], operands[1], i),
+					get_or_expression(nodes, operands[2])
+				);
+				loopExpression->set_static_type(get_string(operands[3], operands[4]));
+				nodes.at(i) = loopExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::WHILE: {
+				auto whileExpression = std::make_shared<daedalus::entropia::ast::WhileExpression>(
+					get_list(operands[0], operands[1], i),
+					get_node(operands[2], i),
+					get_or_expression(nodes, operands[3])
+				);
+				whileExpression->set_static_type(get_string(operands[4], operands[5]));
+				nodes.at(i) = whileExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::FOR: {
+				auto forExpression = std::make_shared<daedalus::entropia::ast::ForExpression>(
+					get_list(operands[0], operands[1], i),
+					get_node(operands[2], i),
+					get_node(operands[3], i),
+					get_node(operands[4], i),
+					get_or_expression(nodes, operands[5])
+				);
+				forExpression->set_static_type(get_string(operands[6], operands[7]));
+				nodes.at(i) = forExpression;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::BREAK:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::BreakExpression>();
+				break;
+			case daedalus::entropia::cache::NodeKind::CONTINUE:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::ContinueExpression>();
+				break;
+			case daedalus::entropia::cache::NodeKind::CONDITIONNAL_EXPRESSION:
+				nodes.at(i) = std::make_shared<daedalus::entropia::ast::ConditionnalExpression>(
+					get_list(operands[0], operands[1], i),
+					get_node(operands[2], i),
+					std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalExpression>(get_node(operands[3], i))
+				);
+				break;
+			case daedalus::entropia::cache::NodeKind::CONDITIONNAL_STRUCTURE: {
+				auto expressions = std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>>();
+				for(std::shared_ptr<daedalus::core::ast::Expression> expression : get_list(operands[0], operands[1], i)) {
+					expressions.push_back(std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalExpression>(expression));
+				}
+				auto conditionnalStructure = std::make_shared<daedalus::entropia::ast::ConditionnalStructure>(expressions);
+				conditionnalStructure->set_static_type(get_string(operands[2], operands[3]));
+				nodes.at(i) = conditionnalStructure;
+				break;
+			}
+			case daedalus::entropia::cache::NodeKind::PAR_FOR: {
+				auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(get_node(operands[0], i));
+				DAE_ASSERT_TRUE(
+					forExpression != nullptr && forExpression->type() == "ForExpression",
+					std::runtime_error("Invalid cache: par for without its for record")
+				)
+				auto reductions = std::vector<daedalus::entropia::ast::Reduction>();
+				std::string reductionList = get_string(operands[1], operands[2]);
+				for(size_t start = 0; start < reductionList.size();) {
+					size_t end = std::min(reductionList.find(',', start), reductionList.size());
+					size_t colon = reductionList.find(':', start);
+					DAE_ASSERT_TRUE(
+						colon < end,
+						std::runtime_error("Invalid cache: malformed reduction")
+					)
+					reductions.push_back({ reductionList.substr(start, colon - start), reductionList.substr(colon + 1, end - colon - 1) });
+					start = end + 1;
+				}
+				auto parallelForExpression = std::make_shared<daedalus::entropia::ast::ParallelForExpression>(
+					forExpression->get_body(),
+					forExpression->get_initial_expression(),
+					forExpression->get_condition(),
+					forExpression->get_update_expression(),
+					reductions,
+					forExpression->get_or_expression()
+				);
+				parallelForExpression->set_static_type(forExpression->get_static_type());
+				nodes.at(i) = parallelForExpression;
+				break;
+			}
+			default:
+				throw std::runtime_error("Invalid cache: unknown node kind");
+		}
+	}
+
+	return std::make_shared<daedalus::core::ast::Scope>(get_list(header.programList, header.programSize, header.nodeCount));
+}
+
+std::shared_ptr<daedalus::core::ast::Scope> daedalus::entropia::cache::load_program(std::string path, uint64_t hash) {
+#ifndef _WIN32
+	int fd = open(path.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return nullptr;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+		close(fd);
+		return nullptr;
+	}
+
+	size_t size = static_cast<size_t>(fileStat.st_size);
+	void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if(data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	std::shared_ptr<daedalus::core::ast::Scope> program = nullptr;
+	try {
+		program = read_program(static_cast<const char*>(data), size, hash);
+	} catch(const std::exception&) {
+		program = nullptr;
+	}
+
+	munmap(data, size);
+
+	return program;
+#else
+	std::ifstream file = std::ifstream(path, std::ios::binary | std::ios::ate);
+	if(!file.is_open()) {
+		return nullptr;
+	}
+
+	std::string data = std::string(static_cast<size_t>(file.tellg()), '\0');
+	file.seekg(0);
+	file.read(&data[0], data.size());
+
+	try {
+		return read_program(data.data(), data.size(), hash);
+	} catch(const std::exception&) {
+		return nullptr;
+	}
+#endif
+}
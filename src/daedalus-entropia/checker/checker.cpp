@@ -0,0 +1,379 @@
+#include <daedalus/Entropia/checker/checker.hpp>
+
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+
+bool daedalus::entropia::checker::is_number_type(std::string type) {
+	return
+		type == daedalus::entropia::checker::NUMBER_TYPE ||
+		type == "i8" || type == "i16" || type == "i32" || type == "i64" ||
+		type == "u8" || type == "u16" || type == "u32" || type == "u64" ||
+		type == "f32" || type == "f64";
+}
+
+bool daedalus::entropia::checker::is_assignable(std::string target, std::string source) {
+	if(source == daedalus::entropia::checker::NO_TYPE || source == daedalus::entropia::checker::MIXED_TYPE) {
+		return false;
+	}
+	// Every number type shares the same runtime value, the range of the literals is checked by the parser
+	return source == target || (is_number_type(target) && is_number_type(source));
+}
+
+std::string daedalus::entropia::checker::unify_types(std::string first, std::string second) {
+	if(first == daedalus::entropia::checker::NO_TYPE) {
+		return second;
+	}
+	if(second == daedalus::entropia::checker::NO_TYPE || first == second) {
+		return first;
+	}
+	if(is_number_type(first) && is_number_type(second)) {
+		return daedalus::entropia::checker::NUMBER_TYPE;
+	}
+	return daedalus::entropia::checker::MIXED_TYPE;
+}
+
+daedalus::entropia::checker::TypeChecker::TypeChecker(std::unordered_map<std::string, std::string> globals) :
+	scopes({ globals }),
+	globals(),
+	reductions(),
+	parallelScope(0),
+	parallelLoops(0)
+{
+	for(const auto& [name, type] : globals) {
+		this->globals.insert(name);
+	}
+}
+
+daedalus::entropia::checker::TypeChecker::TypeChecker(daedalus::entropia::ast::DeferredCheck deferredCheck) :
+	scopes(deferredCheck.scopes),
+	globals(deferredCheck.globals),
+	reductions(deferredCheck.reductions),
+	parallelScope(deferredCheck.parallelScope),
+	parallelLoops(deferredCheck.parallelLoops)
+{}
+
+void daedalus::entropia::checker::TypeChecker::check(std::shared_ptr<daedalus::core::ast::Scope> program) {
+	this->scopes.push_back(std::unordered_map<std::string, std::string>());
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : program->get_body()) {
+		this->check_statement(expression);
+	}
+	this->scopes.pop_back();
+}
+
+void daedalus::entropia::checker::TypeChecker::check_statement(std::shared_ptr<daedalus::core::ast::Expression> statement) {
+	std::string escapeType = daedalus::entropia::checker::NO_TYPE;
+	(void)this->infer_type(statement, escapeType);
+}
+
+std::string daedalus::entropia::checker::TypeChecker::get_declared_type(std::string name) {
+	return this->scopes.at(this->get_declaration_scope(name)).at(name);
+}
+
+size_t daedalus::entropia::checker::TypeChecker::get_declaration_scope(std::string name) {
+	for(size_t scope = this->scopes.size(); scope > 0; scope--) {
+		if(this->scopes.at(scope - 1).count(name) > 0) {
+			return scope - 1;
+		}
+	}
+	throw std::runtime_error("Trying to access undeclared value \"" + name + "\"");
+}
+
+std::string daedalus::entropia::checker::TypeChecker::infer_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body, std::string& escapeType) {
+	this->scopes.push_back(std::unordered_map<std::string, std::string>());
+
+	std::string lastType = daedalus::entropia::checker::NO_TYPE;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		if(expression->type() == "BreakExpression" || expression->type() == "ContinueExpression") {
+			DAE_ASSERT_TRUE(
+				this->parallelScope == 0 || this->parallelLoops > 0 || expression->type() != "BreakExpression",
+				std::runtime_error("Trying to break out of a par for")
+			)
+			// The scope escapes with the value of the statement before the break / continue
+			escapeType = daedalus::entropia::checker::unify_types(escapeType, lastType);
+			lastType = daedalus::entropia::checker::NO_TYPE;
+			continue;
+		}
+		lastType = this->infer_type(expression, escapeType);
+	}
+
+	this->scopes.pop_back();
+
+	return lastType;
+}
+
+std::string daedalus::entropia::checker::TypeChecker::infer_type(std::shared_ptr<daedalus::core::ast::Expression> expression, std::string& escapeType) {
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		return daedalus::entropia::checker::NUMBER_TYPE;
+	}
+	if(type == "BooleanExpression") {
+		return "bool";
+	}
+	if(type == "CharExpression") {
+		return "char";
+	}
+	if(type == "StrExpression") {
+		return "str";
+	}
+	if(type == "Identifier") {
+		auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression);
+		DAE_ASSERT_TRUE(
+			this->reductions.count(identifier->get_name()) == 0 || this->get_declaration_scope(identifier->get_name()) >= this->parallelScope,
+			std::runtime_error("Trying to read the reduction \"" + identifier->get_name() + "\" inside its par for")
+		)
+		identifier->set_static_type(this->get_declared_type(identifier->get_name()));
+		return identifier->get_static_type();
+	}
+	if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		(void)this->infer_type(unaryExpression->get_term(), escapeType);
+		DAE_ASSERT_TRUE(
+			unaryExpression->get_operator_symbol() == "!",
+			std::runtime_error("Unknown unary operator " + unaryExpression->get_operator_symbol())
+		)
+		unaryExpression->set_static_type("bool");
+		return unaryExpression->get_static_type();
+	}
+	if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		std::string left = this->infer_type(binaryExpression->get_left(), escapeType);
+		std::string right = this->infer_type(binaryExpression->get_right(), escapeType);
+		std::string operator_symbol = binaryExpression->get_operator_symbol();
+
+		bool numbers = is_number_type(left) && is_number_type(right);
+
+		if(operator_symbol == "+" || operator_symbol == "-" || operator_symbol == "*" || operator_symbol == "/") {
+			DAE_ASSERT_TRUE(
+				numbers,
+				std::runtime_error("Trying to compute invalid operands : " + left + " " + operator_symbol + " " + right)
+			)
+			binaryExpression->set_static_type(left == right ? left : daedalus::entropia::checker::NUMBER_TYPE);
+		}
+		else if(operator_symbol == "==" || operator_symbol == "!=") {
+			DAE_ASSERT_TRUE(
+				numbers || (left == right && (left == "bool" || left == "char" || left == "str")),
+				std::runtime_error("Trying to check equality on invalid operands : " + left + " " + operator_symbol + " " + right)
+			)
+			binaryExpression->set_static_type("bool");
+		}
+		else if(operator_symbol == "<" || operator_symbol == ">" || operator_symbol == "<=" || operator_symbol == ">=") {
+			DAE_ASSERT_TRUE(
+				numbers,
+				std::runtime_error("Trying to compare invalid operands : " + left + " " + operator_symbol + " " + right)
+			)
+			binaryExpression->set_static_type("bool");
+		}
+		else if(operator_symbol == "&&" || operator_symbol == "||") {
+			binaryExpression->set_static_type("bool");
+		}
+		else {
+			throw std::runtime_error("Unknown operator " + operator_symbol);
+		}
+		return binaryExpression->get_static_type();
+	}
+	if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		std::string name = declarationExpression->get_identifier()->get_name();
+		std::string valueType = this->infer_type(declarationExpression->get_value(), escapeType);
+		DAE_ASSERT_TRUE(
+			is_assignable(declarationExpression->get_value_type(), valueType),
+			std::runtime_error("Trying to assign value of type \"" + valueType + "\" to \"" + name + "\" of type \"" + declarationExpression->get_value_type() + "\"")
+		)
+		this->scopes.back()[name] = declarationExpression->get_value_type();
+		declarationExpression->get_identifier()->set_static_type(declarationExpression->get_value_type());
+		declarationExpression->set_static_type(declarationExpression->get_value_type());
+		return declarationExpression->get_static_type();
+	}
+	if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		std::string name = assignationExpression->get_identifier()->get_name();
+		std::string declaredType = this->get_declared_type(name);
+		DAE_ASSERT_TRUE(
+			this->globals.count(name) == 0 || this->get_declaration_scope(name) > 0,
+			std::runtime_error("Trying to assign to immutable value \"" + name + "\"")
+		)
+		std::string valueType = daedalus::entropia::checker::NO_TYPE;
+		if(this->parallelScope > 0 && this->get_declaration_scope(name) < this->parallelScope) {
+			// Each chunk of iterations updates its own copy of a reduction, never read by the others
+			auto reduction = this->reductions.find(name);
+			DAE_ASSERT_TRUE(
+				reduction != this->reductions.end(),
+				std::runtime_error("Trying to assign \"" + name + "\" declared outside of a par for (only its reductions can be)")
+			)
+			auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(assignationExpression->get_value());
+			auto left = binaryExpression != nullptr ?
+				std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(binaryExpression->get_left()) :
+				nullptr;
+			DAE_ASSERT_TRUE(
+				left != nullptr && left->get_name() == name && binaryExpression->get_operator_symbol() == reduction->second,
+				std::runtime_error("Expected reduction update " + name + " = " + name + " " + reduction->second + " <expression>")
+			)
+			// The operand can't read the reduction, the update itself can
+			(void)this->infer_type(binaryExpression->get_right(), escapeType);
+			std::string operator_symbol = reduction->second;
+			this->reductions.erase(reduction);
+			valueType = this->infer_type(binaryExpression, escapeType);
+			this->reductions[name] = operator_symbol;
+		} else {
+			valueType = this->infer_type(assignationExpression->get_value(), escapeType);
+		}
+		DAE_ASSERT_TRUE(
+			is_assignable(declaredType, valueType),
+			std::runtime_error("Trying to assign value of type \"" + valueType + "\" to \"" + name + "\" of type \"" + declaredType + "\"")
+		)
+		assignationExpression->get_identifier()->set_static_type(declaredType);
+		assignationExpression->set_static_type(declaredType);
+		return assignationExpression->get_static_type();
+	}
+	if(type == "OrExpression") {
+		return this->infer_type(std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression)->get_value(), escapeType);
+	}
+	if(type == "ParallelForExpression") {
+		return this->infer_parallel_for(std::dynamic_pointer_cast<daedalus::entropia::ast::ParallelForExpression>(expression), escapeType);
+	}
+	if(type == "LoopExpression" || type == "WhileExpression" || type == "ForExpression") {
+		auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression);
+		auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(expression);
+
+		// A break in a loop of a par for only ends the inner loop
+		this->parallelLoops++;
+
+		// The break / continue of the body are caught by the loop
+		std::string loopEscapeType = daedalus::entropia::checker::NO_TYPE;
+		std::string bodyType = daedalus::entropia::checker::NO_TYPE;
+
+		if(forExpression != nullptr) {
+			this->scopes.push_back(std::unordered_map<std::string, std::string>());
+			(void)this->infer_type(forExpression->get_initial_expression(), loopEscapeType);
+			(void)this->infer_type(forExpression->get_condition(), loopEscapeType);
+			(void)this->infer_body(forExpression->get_body(), loopEscapeType);
+			// The update expression is the last statement of each iteration
+			bodyType = this->infer_type(forExpression->get_update_expression(), loopEscapeType);
+			this->scopes.pop_back();
+		} else {
+			if(auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(expression)) {
+				(void)this->infer_type(whileExpression->get_condition(), loopEscapeType);
+			}
+			bodyType = this->infer_body(loopExpression->get_body(), loopEscapeType);
+		}
+		this->parallelLoops--;
+
+		std::string orType = loopExpression->get_or_expression() != nullptr ?
+			this->infer_type(loopExpression->get_or_expression(), escapeType) :
+			daedalus::entropia::checker::NO_TYPE;
+
+		loopExpression->set_static_type(
+			daedalus::entropia::checker::unify_types(
+				daedalus::entropia::checker::unify_types(bodyType, loopEscapeType),
+				orType
+			)
+		);
+		return loopExpression->get_static_type();
+	}
+	if(type == "BreakExpression" || type == "ContinueExpression") {
+		return daedalus::entropia::checker::NO_TYPE;
+	}
+	if(type == "ConditionnalStructure") {
+		auto conditionnalStructure = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression);
+		std::string structureType = daedalus::entropia::checker::NO_TYPE;
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : conditionnalStructure->get_expressions()) {
+			if(conditionnalExpression->get_condition() != nullptr) {
+				(void)this->infer_type(conditionnalExpression->get_condition(), escapeType);
+			}
+			// A break / continue in a branch escapes through the structure to the enclosing loop
+			structureType = daedalus::entropia::checker::unify_types(
+				structureType,
+				this->infer_body(conditionnalExpression->get_body(), escapeType)
+			);
+		}
+		conditionnalStructure->set_static_type(structureType);
+		return conditionnalStructure->get_static_type();
+	}
+
+	if(type == "LazyScope") {
+		// The body is checked once parsed, from the scopes, inputs and par for seen from here
+		std::dynamic_pointer_cast<daedalus::entropia::ast::LazyScope>(expression)->set_deferred_check(daedalus::entropia::ast::DeferredCheck{
+			this->scopes,
+			this->globals,
+			this->reductions,
+			this->parallelScope,
+			this->parallelLoops
+		});
+		return daedalus::entropia::checker::NO_TYPE;
+	}
+
+	throw std::runtime_error("Trying to infer the type of unknown node " + type);
+}
+
+std::string daedalus::entropia::checker::TypeChecker::infer_parallel_for(
+	std::shared_ptr<daedalus::entropia::ast::ParallelForExpression> parallelForExpression,
+	std::string& escapeType
+) {
+	std::shared_ptr<daedalus::entropia::ast::CountedLoop> countedLoop = daedalus::entropia::optimizer::get_counted_loop(parallelForExpression);
+	DAE_ASSERT_TRUE(
+		countedLoop != nullptr,
+		std::runtime_error("A par for must be counted : for(let mut i: <integer> = ...; i <comparison> <bound>; i = i +/- <constant>), without continue")
+	)
+	DAE_ASSERT_TRUE(
+		countedLoop->step != 0,
+		std::runtime_error("A par for needs a non zero step")
+	)
+
+	auto reductions = std::unordered_map<std::string, std::string>();
+	for(const daedalus::entropia::ast::Reduction& reduction : parallelForExpression->get_reductions()) {
+		DAE_ASSERT_TRUE(
+			reductions.count(reduction.name) == 0 && reduction.name != countedLoop->name,
+			std::runtime_error("Invalid reduction \"" + reduction.name + "\" (declared twice or loop variable)")
+		)
+		std::string reductionType = this->get_declared_type(reduction.name);
+		bool isLogical = reduction.operator_symbol == "&&" || reduction.operator_symbol == "||";
+		DAE_ASSERT_TRUE(
+			isLogical ? reductionType == "bool" : is_number_type(reductionType),
+			std::runtime_error("Trying to reduce \"" + reduction.name + "\" of type \"" + reductionType + "\" with " + reduction.operator_symbol)
+		)
+		// Inside another par for, only its own reductions (with the same operator) can be combined into
+		if(this->parallelScope > 0 && this->get_declaration_scope(reduction.name) < this->parallelScope) {
+			auto outerReduction = this->reductions.find(reduction.name);
+			DAE_ASSERT_TRUE(
+				outerReduction != this->reductions.end() && outerReduction->second == reduction.operator_symbol,
+				std::runtime_error("Trying to reduce \"" + reduction.name + "\" with " + reduction.operator_symbol + " inside a par for that doesn't")
+			)
+		}
+		reductions[reduction.name] = reduction.operator_symbol;
+	}
+
+	std::string loopEscapeType = daedalus::entropia::checker::NO_TYPE;
+
+	this->scopes.push_back(std::unordered_map<std::string, std::string>());
+	(void)this->infer_type(parallelForExpression->get_initial_expression(), loopEscapeType);
+	(void)this->infer_type(parallelForExpression->get_condition(), loopEscapeType);
+
+	std::unordered_map<std::string, std::string> outerReductions = this->reductions;
+	size_t outerParallelScope = this->parallelScope;
+	size_t outerParallelLoops = this->parallelLoops;
+	this->reductions = reductions;
+	// The loop variable is outside of the body, only the update writes it
+	this->parallelScope = this->scopes.size();
+	this->parallelLoops = 0;
+
+	(void)this->infer_body(parallelForExpression->get_body(), loopEscapeType);
+
+	this->reductions = outerReductions;
+	this->parallelScope = outerParallelScope;
+	this->parallelLoops = outerParallelLoops;
+
+	std::string bodyType = this->infer_type(parallelForExpression->get_update_expression(), loopEscapeType);
+	this->scopes.pop_back();
+
+	std::string orType = parallelForExpression->get_or_expression() != nullptr ?
+		this->infer_type(parallelForExpression->get_or_expression(), escapeType) :
+		daedalus::entropia::checker::NO_TYPE;
+
+	parallelForExpression->set_static_type(
+		daedalus::entropia::checker::unify_types(
+			daedalus::entropia::checker::unify_types(bodyType, loopEscapeType),
+			orType
+		)
+	);
+	return parallelForExpression->get_static_type();
+}
@@ -0,0 +1,496 @@
+#include <daedalus/Entropia/columnar/columnar.hpp>
+
+#include <algorithm>
+#include <functional>
+
+daedalus::entropia::columnar::ColumnType daedalus::entropia::columnar::get_column_type(std::string type) {
+	if(daedalus::entropia::checker::is_number_type(type)) {
+		return daedalus::entropia::columnar::ColumnType::NUMBER;
+	}
+	if(type == "bool") {
+		return daedalus::entropia::columnar::ColumnType::BOOLEAN;
+	}
+	if(type == "char") {
+		return daedalus::entropia::columnar::ColumnType::CHAR;
+	}
+	throw std::runtime_error("No column for values of type \"" + type + "\"");
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::make_column(daedalus::entropia::columnar::ColumnType type, size_t size) {
+	daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::Column();
+	column.type = type;
+	if(type == daedalus::entropia::columnar::ColumnType::NUMBER) {
+		column.numbers.resize(size);
+	} else if(type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+		column.booleans.resize(size);
+	} else if(type == daedalus::entropia::columnar::ColumnType::CHAR) {
+		column.chars.resize(size);
+	}
+	return column;
+}
+
+size_t daedalus::entropia::columnar::add_row(daedalus::entropia::columnar::Batch& batch) {
+	for(auto& [name, column] : batch.inputs) {
+		if(column.type == daedalus::entropia::columnar::ColumnType::NUMBER) {
+			column.numbers.push_back(0);
+		} else if(column.type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+			column.booleans.push_back(0);
+		} else if(column.type == daedalus::entropia::columnar::ColumnType::CHAR) {
+			column.chars.push_back('\0');
+		}
+	}
+	batch.failed.push_back(0);
+	batch.errors.push_back("");
+	return batch.size++;
+}
+
+void daedalus::entropia::columnar::fail_row(daedalus::entropia::columnar::Batch& batch, size_t row, std::string error) {
+	if(batch.failed.at(row) == 0) {
+		batch.failed.at(row) = 1;
+		batch.errors.at(row) = error;
+	}
+}
+
+void daedalus::entropia::columnar::clear_batch(daedalus::entropia::columnar::Batch& batch) {
+	batch.size = 0;
+	for(auto& [name, column] : batch.inputs) {
+		column.numbers.clear();
+		column.booleans.clear();
+		column.chars.clear();
+	}
+	batch.failed.clear();
+	batch.errors.clear();
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::columnar::get_row_value(const daedalus::entropia::columnar::Column& column, size_t row) {
+	if(column.type == daedalus::entropia::columnar::ColumnType::NUMBER) {
+		return daedalus::entropia::values::get_number(column.numbers.at(row));
+	}
+	if(column.type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+		return daedalus::entropia::values::get_boolean(column.booleans.at(row) != 0);
+	}
+	if(column.type == daedalus::entropia::columnar::ColumnType::CHAR) {
+		return daedalus::entropia::values::get_char(column.chars.at(row));
+	}
+	return daedalus::entropia::values::get_null();
+}
+
+#pragma region Kernels
+
+// Plain loops over the arrays, without branches, for the compiler to vectorize them
+
+template<typename Type, typename Result, typename Operation>
+static void apply_operation(const std::vector<Type>& left, const std::vector<Type>& right, std::vector<Result>& out) {
+	const Type* leftValues = left.data();
+	const Type* rightValues = right.data();
+	Result* outValues = out.data();
+	size_t size = out.size();
+	for(size_t i = 0; i < size; i++) {
+		outValues[i] = static_cast<Result>(Operation()(leftValues[i], rightValues[i]));
+	}
+}
+
+template<typename Type>
+static void blend(const std::vector<Type>& values, const std::vector<uint8_t>& mask, std::vector<Type>& out) {
+	const Type* newValues = values.data();
+	const uint8_t* maskValues = mask.data();
+	Type* outValues = out.data();
+	size_t size = out.size();
+	for(size_t i = 0; i < size; i++) {
+		outValues[i] = maskValues[i] != 0 ? newValues[i] : outValues[i];
+	}
+}
+
+/**
+ * Truthiness of each value, like IsTrue
+ */
+static std::vector<uint8_t> get_truths(const daedalus::entropia::columnar::Column& column) {
+	if(column.type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+		return column.booleans;
+	}
+	auto truths = std::vector<uint8_t>(column.type == daedalus::entropia::columnar::ColumnType::NUMBER ? column.numbers.size() : column.chars.size());
+	for(size_t i = 0; i < truths.size(); i++) {
+		truths[i] = column.type == daedalus::entropia::columnar::ColumnType::NUMBER ? column.numbers[i] != 0 : column.chars[i] != '\0';
+	}
+	return truths;
+}
+
+static void blend_column(const daedalus::entropia::columnar::Column& values, const std::vector<uint8_t>& mask, daedalus::entropia::columnar::Column& out) {
+	if(out.type == daedalus::entropia::columnar::ColumnType::NUMBER) {
+		blend(values.numbers, mask, out.numbers);
+	} else if(out.type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+		blend(values.booleans, mask, out.booleans);
+	} else if(out.type == daedalus::entropia::columnar::ColumnType::CHAR) {
+		blend(values.chars, mask, out.chars);
+	}
+}
+
+static bool is_any_row(const std::vector<uint8_t>& mask) {
+	for(uint8_t row : mask) {
+		if(row != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#pragma endregion
+
+#pragma region ColumnarProgram
+
+daedalus::entropia::columnar::ColumnarProgram::ColumnarProgram(std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program) :
+	program(program),
+	inputTypes(),
+	types()
+{
+	for(const auto& [name, type] : program->get_input_types()) {
+		if(type != "str") {
+			this->inputTypes[name] = daedalus::entropia::columnar::get_column_type(type);
+		}
+	}
+
+	TypeScopes scopes = TypeScopes();
+	(void)this->infer_body(program->get_program()->get_body(), scopes);
+}
+
+daedalus::entropia::columnar::ColumnType daedalus::entropia::columnar::ColumnarProgram::infer_body(
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+	TypeScopes& scopes
+) {
+	scopes.push_back(std::unordered_map<std::string, daedalus::entropia::columnar::ColumnType>());
+	daedalus::entropia::columnar::ColumnType lastType = daedalus::entropia::columnar::ColumnType::NONE;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		lastType = this->infer_type(expression, scopes);
+	}
+	scopes.pop_back();
+	return lastType;
+}
+
+daedalus::entropia::columnar::ColumnType daedalus::entropia::columnar::ColumnarProgram::infer_type(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	TypeScopes& scopes
+) {
+	typedef daedalus::entropia::columnar::ColumnType ColumnType;
+
+	std::string type = expression->type();
+	ColumnType columnType = ColumnType::NONE;
+
+	if(type == "NumberExpression") {
+		columnType = ColumnType::NUMBER;
+	} else if(type == "BooleanExpression") {
+		columnType = ColumnType::BOOLEAN;
+	} else if(type == "CharExpression") {
+		columnType = ColumnType::CHAR;
+	} else if(type == "Identifier") {
+		std::string name = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression)->get_name();
+		bool isFound = false;
+		for(auto scope = scopes.rbegin(); scope != scopes.rend() && !isFound; scope++) {
+			auto binding = scope->find(name);
+			if(binding != scope->end()) {
+				columnType = binding->second;
+				isFound = true;
+			}
+		}
+		if(!isFound) {
+			auto input = this->inputTypes.find(name);
+			DAE_ASSERT_TRUE(
+				input != this->inputTypes.end(),
+				std::runtime_error("No column for \"" + name + "\"")
+			)
+			columnType = input->second;
+		}
+	} else if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		DAE_ASSERT_TRUE(
+			unaryExpression->get_operator_symbol() == "!",
+			std::runtime_error("No column kernel for " + unaryExpression->get_operator_symbol())
+		)
+		(void)this->infer_type(unaryExpression->get_term(), scopes);
+		columnType = ColumnType::BOOLEAN;
+	} else if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		std::string operator_symbol = binaryExpression->get_operator_symbol();
+		ColumnType left = this->infer_type(binaryExpression->get_left(), scopes);
+		ColumnType right = this->infer_type(binaryExpression->get_right(), scopes);
+
+		if(operator_symbol == "&&" || operator_symbol == "||") {
+			DAE_ASSERT_TRUE(
+				left != ColumnType::NONE && right != ColumnType::NONE,
+				std::runtime_error("No column kernel for " + operator_symbol + " without value")
+			)
+			columnType = ColumnType::BOOLEAN;
+		} else if(operator_symbol == "==" || operator_symbol == "!=") {
+			DAE_ASSERT_TRUE(
+				left == right && left != ColumnType::NONE,
+				std::runtime_error("No column kernel for " + operator_symbol + " between different types")
+			)
+			columnType = ColumnType::BOOLEAN;
+		} else {
+			bool isArithmetic = operator_symbol == "+" || operator_symbol == "-" || operator_symbol == "*" || operator_symbol == "/";
+			bool isComparison = operator_symbol == "<" || operator_symbol == ">" || operator_symbol == "<=" || operator_symbol == ">=";
+			DAE_ASSERT_TRUE(
+				(isArithmetic || isComparison) && left == ColumnType::NUMBER && right == ColumnType::NUMBER,
+				std::runtime_error("No column kernel for " + operator_symbol)
+			)
+			columnType = isArithmetic ? ColumnType::NUMBER : ColumnType::BOOLEAN;
+		}
+	} else if(type == "DeclarationExpression" || type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		std::string name = assignationExpression->get_identifier()->get_name();
+		columnType = this->infer_type(assignationExpression->get_value(), scopes);
+		DAE_ASSERT_TRUE(
+			columnType != ColumnType::NONE,
+			std::runtime_error("No column for \"" + name + "\" without value")
+		)
+		if(type == "DeclarationExpression") {
+			scopes.back()[name] = columnType;
+		} else {
+			// Only the values of the program, the checker rejects the assignments to the inputs
+			DAE_ASSERT_TRUE(
+				this->infer_type(assignationExpression->get_identifier(), scopes) == columnType,
+				std::runtime_error("No column kernel to assign \"" + name + "\" another type")
+			)
+		}
+	} else if(type == "ConditionnalStructure") {
+		bool isFirst = true;
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)->get_expressions()) {
+			if(conditionnalExpression->get_condition() != nullptr) {
+				DAE_ASSERT_TRUE(
+					this->infer_type(conditionnalExpression->get_condition(), scopes) != ColumnType::NONE,
+					std::runtime_error("No column kernel for a condition without value")
+				)
+			}
+			ColumnType bodyType = this->infer_body(conditionnalExpression->get_body(), scopes);
+			DAE_ASSERT_TRUE(
+				isFirst || bodyType == columnType,
+				std::runtime_error("No column for branches of different types")
+			)
+			columnType = bodyType;
+			isFirst = false;
+		}
+	} else {
+		throw std::runtime_error("No column kernel for " + type);
+	}
+
+	this->types[expression.get()] = columnType;
+	return columnType;
+}
+
+daedalus::entropia::columnar::Batch daedalus::entropia::columnar::ColumnarProgram::make_batch() const {
+	daedalus::entropia::columnar::Batch batch = daedalus::entropia::columnar::Batch();
+	batch.size = 0;
+	for(const auto& [name, columnType] : this->inputTypes) {
+		batch.inputs[name] = daedalus::entropia::columnar::make_column(columnType, 0);
+	}
+	return batch;
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::ColumnarProgram::run(daedalus::entropia::columnar::Batch& batch) const {
+	// Rows failed while their fields were read don't run
+	auto mask = std::vector<uint8_t>(batch.size);
+	for(size_t row = 0; row < batch.size; row++) {
+		mask[row] = batch.failed[row] == 0;
+	}
+
+	ColumnScopes scopes = ColumnScopes();
+	return this->evaluate_body(this->program->get_program()->get_body(), mask, batch, scopes);
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::ColumnarProgram::evaluate_body(
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+	const std::vector<uint8_t>& mask,
+	daedalus::entropia::columnar::Batch& batch,
+	ColumnScopes& scopes
+) const {
+	scopes.push_back(std::unordered_map<std::string, daedalus::entropia::columnar::Column>());
+	daedalus::entropia::columnar::Column last = daedalus::entropia::columnar::make_column(daedalus::entropia::columnar::ColumnType::NONE, 0);
+
+	// A row stops at its first error, like a record run alone
+	std::vector<uint8_t> active = mask;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		for(size_t row = 0; row < active.size(); row++) {
+			active[row] = active[row] != 0 && batch.failed[row] == 0;
+		}
+		last = this->evaluate(expression, active, batch, scopes);
+	}
+
+	scopes.pop_back();
+	return last;
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::ColumnarProgram::evaluate(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	const std::vector<uint8_t>& mask,
+	daedalus::entropia::columnar::Batch& batch,
+	ColumnScopes& scopes
+) const {
+	typedef daedalus::entropia::columnar::ColumnType ColumnType;
+
+	std::string type = expression->type();
+	ColumnType columnType = this->types.at(expression.get());
+
+	if(type == "NumberExpression") {
+		daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(columnType, batch.size);
+		std::fill(column.numbers.begin(), column.numbers.end(), std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)->get_value());
+		return column;
+	}
+	if(type == "BooleanExpression") {
+		daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(columnType, batch.size);
+		std::fill(column.booleans.begin(), column.booleans.end(), std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)->get_value());
+		return column;
+	}
+	if(type == "CharExpression") {
+		daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(columnType, batch.size);
+		std::fill(column.chars.begin(), column.chars.end(), std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(expression)->get_value());
+		return column;
+	}
+	if(type == "Identifier") {
+		std::string name = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression)->get_name();
+		for(auto scope = scopes.rbegin(); scope != scopes.rend(); scope++) {
+			auto binding = scope->find(name);
+			if(binding != scope->end()) {
+				return binding->second;
+			}
+		}
+		return batch.inputs.at(name);
+	}
+	if(type == "UnaryExpression") {
+		daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(columnType, batch.size);
+		column.booleans = get_truths(this->evaluate(std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)->get_term(), mask, batch, scopes));
+		for(uint8_t& value : column.booleans) {
+			value = value == 0;
+		}
+		return column;
+	}
+	if(type == "BinaryExpression") {
+		return this->evaluate_binary_expression(std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression), mask, batch, scopes);
+	}
+	if(type == "DeclarationExpression" || type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		std::string name = assignationExpression->get_identifier()->get_name();
+		daedalus::entropia::columnar::Column value = this->evaluate(assignationExpression->get_value(), mask, batch, scopes);
+		if(type == "DeclarationExpression") {
+			scopes.back()[name] = value;
+			return value;
+		}
+		// Only the rows reaching the assignment change the value
+		for(auto scope = scopes.rbegin(); scope != scopes.rend(); scope++) {
+			auto binding = scope->find(name);
+			if(binding != scope->end()) {
+				blend_column(value, mask, binding->second);
+				break;
+			}
+		}
+		return value;
+	}
+	if(type == "ConditionnalStructure") {
+		return this->evaluate_conditionnal_structure(std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression), mask, batch, scopes);
+	}
+
+	throw std::runtime_error("No column kernel for " + type);
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::ColumnarProgram::evaluate_binary_expression(
+	std::shared_ptr<daedalus::entropia::ast::BinaryExpression> binaryExpression,
+	const std::vector<uint8_t>& mask,
+	daedalus::entropia::columnar::Batch& batch,
+	ColumnScopes& scopes
+) const {
+	typedef daedalus::entropia::columnar::ColumnType ColumnType;
+
+	// Both operands are evaluated, like the interpreter (no short circuit)
+	daedalus::entropia::columnar::Column left = this->evaluate(binaryExpression->get_left(), mask, batch, scopes);
+	daedalus::entropia::columnar::Column right = this->evaluate(binaryExpression->get_right(), mask, batch, scopes);
+	daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(this->types.at(binaryExpression.get()), batch.size);
+	std::string operator_symbol = binaryExpression->get_operator_symbol();
+
+	if(operator_symbol == "&&" || operator_symbol == "||") {
+		std::vector<uint8_t> leftTruths = get_truths(left);
+		std::vector<uint8_t> rightTruths = get_truths(right);
+		if(operator_symbol == "&&") {
+			apply_operation<uint8_t, uint8_t, std::bit_and<uint8_t>>(leftTruths, rightTruths, column.booleans);
+		} else {
+			apply_operation<uint8_t, uint8_t, std::bit_or<uint8_t>>(leftTruths, rightTruths, column.booleans);
+		}
+		return column;
+	}
+
+	if(operator_symbol == "==" || operator_symbol == "!=") {
+		if(left.type == ColumnType::NUMBER) {
+			apply_operation<double, uint8_t, std::equal_to<double>>(left.numbers, right.numbers, column.booleans);
+		} else if(left.type == ColumnType::BOOLEAN) {
+			apply_operation<uint8_t, uint8_t, std::equal_to<uint8_t>>(left.booleans, right.booleans, column.booleans);
+		} else {
+			apply_operation<char, uint8_t, std::equal_to<char>>(left.chars, right.chars, column.booleans);
+		}
+		if(operator_symbol == "!=") {
+			for(uint8_t& value : column.booleans) {
+				value = value == 0;
+			}
+		}
+		return column;
+	}
+
+	if(operator_symbol == "+") {
+		apply_operation<double, double, std::plus<double>>(left.numbers, right.numbers, column.numbers);
+	} else if(operator_symbol == "-") {
+		apply_operation<double, double, std::minus<double>>(left.numbers, right.numbers, column.numbers);
+	} else if(operator_symbol == "*") {
+		apply_operation<double, double, std::multiplies<double>>(left.numbers, right.numbers, column.numbers);
+	} else if(operator_symbol == "/") {
+		// Every row is divided, only the ones reaching the division fail
+		apply_operation<double, double, std::divides<double>>(left.numbers, right.numbers, column.numbers);
+		for(size_t row = 0; row < batch.size; row++) {
+			if(mask[row] != 0 && right.numbers[row] == 0) {
+				daedalus::entropia::columnar::fail_row(batch, row, "Trying to divide by zero");
+			}
+		}
+	} else if(operator_symbol == "<") {
+		apply_operation<double, uint8_t, std::less<double>>(left.numbers, right.numbers, column.booleans);
+	} else if(operator_symbol == ">") {
+		apply_operation<double, uint8_t, std::greater<double>>(left.numbers, right.numbers, column.booleans);
+	} else if(operator_symbol == "<=") {
+		apply_operation<double, uint8_t, std::less_equal<double>>(left.numbers, right.numbers, column.booleans);
+	} else if(operator_symbol == ">=") {
+		apply_operation<double, uint8_t, std::greater_equal<double>>(left.numbers, right.numbers, column.booleans);
+	}
+	return column;
+}
+
+daedalus::entropia::columnar::Column daedalus::entropia::columnar::ColumnarProgram::evaluate_conditionnal_structure(
+	std::shared_ptr<daedalus::entropia::ast::ConditionnalStructure> conditionnalStructure,
+	const std::vector<uint8_t>& mask,
+	daedalus::entropia::columnar::Batch& batch,
+	ColumnScopes& scopes
+) const {
+	daedalus::entropia::columnar::Column column = daedalus::entropia::columnar::make_column(this->types.at(conditionnalStructure.get()), batch.size);
+
+	// Rows reaching the next condition, those selecting a branch reach its body only
+	std::vector<uint8_t> pending = mask;
+	auto branchMask = std::vector<uint8_t>(batch.size);
+	for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : conditionnalStructure->get_expressions()) {
+		if(!is_any_row(pending)) {
+			break;
+		}
+
+		if(conditionnalExpression->get_condition() == nullptr) {
+			branchMask = pending;
+			std::fill(pending.begin(), pending.end(), 0);
+		} else {
+			std::vector<uint8_t> truths = get_truths(this->evaluate(conditionnalExpression->get_condition(), pending, batch, scopes));
+			for(size_t row = 0; row < batch.size; row++) {
+				// A row failing in its condition stops there
+				bool isReached = pending[row] != 0 && batch.failed[row] == 0;
+				branchMask[row] = isReached && truths[row] != 0;
+				pending[row] = isReached && truths[row] == 0;
+			}
+		}
+
+		if(is_any_row(branchMask)) {
+			blend_column(this->evaluate_body(conditionnalExpression->get_body(), branchMask, batch, scopes), branchMask, column);
+		}
+	}
+	return column;
+}
+
+#pragma endregion
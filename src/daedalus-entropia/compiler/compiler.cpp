@@ -0,0 +1,662 @@
+#include <daedalus/Entropia/compiler/compiler.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+// Shared by the driver and the generated sources (entropia_recorder)
+static const char* RECORDER_DEFINITION =
+	"struct entropia_recorder {\n"
+	"\tvoid (*number)(void* context, double value);\n"
+	"\tvoid (*boolean)(void* context, bool value);\n"
+	"\tvoid (*character)(void* context, char value);\n"
+	"\tvoid (*string)(void* context, const char* value);\n"
+	"\tvoid (*null)(void* context);\n"
+	"\tvoid* context;\n"
+	"};\n";
+
+static const char* RUNTIME_DEFINITION =
+	"static double entropia_divide(double left, double right) {\n"
+	"\tif(right == 0) {\n"
+	"\t\tthrow std::runtime_error(\"Trying to divide by zero\");\n"
+	"\t}\n"
+	"\treturn left / right;\n"
+	"}\n"
+	"\n"
+	"[[noreturn]] static void entropia_fail(const char* message) {\n"
+	"\tthrow std::runtime_error(message);\n"
+	"}\n"
+	"\n"
+	"// Value of a statement that can be of different types (mixed), null until assigned\n"
+	"enum entropia_kind { ENTROPIA_NULL, ENTROPIA_NUMBER, ENTROPIA_BOOLEAN, ENTROPIA_CHARACTER, ENTROPIA_STRING };\n"
+	"\n"
+	"struct entropia_value {\n"
+	"\tentropia_kind kind;\n"
+	"\tdouble number;\n"
+	"\tstd::string string;\n"
+	"\n"
+	"\tentropia_value() : kind(ENTROPIA_NULL), number(0), string() {}\n"
+	"\tentropia_value(double value) : kind(ENTROPIA_NUMBER), number(value), string() {}\n"
+	"\tentropia_value(bool value) : kind(ENTROPIA_BOOLEAN), number(value), string() {}\n"
+	"\tentropia_value(char value) : kind(ENTROPIA_CHARACTER), number(value), string() {}\n"
+	"\tentropia_value(const std::string& value) : kind(ENTROPIA_STRING), number(0), string(value) {}\n"
+	"};\n"
+	"\n"
+	"static bool entropia_truthy(const entropia_value& value) {\n"
+	"\treturn value.kind == ENTROPIA_STRING ? !value.string.empty() : value.number != 0;\n"
+	"}\n"
+	"\n"
+	"static void entropia_record(entropia_recorder* recorder, const entropia_value& value) {\n"
+	"\tswitch(value.kind) {\n"
+	"\t\tcase ENTROPIA_NUMBER: recorder->number(recorder->context, value.number); break;\n"
+	"\t\tcase ENTROPIA_BOOLEAN: recorder->boolean(recorder->context, value.number != 0); break;\n"
+	"\t\tcase ENTROPIA_CHARACTER: recorder->character(recorder->context, static_cast<char>(value.number)); break;\n"
+	"\t\tcase ENTROPIA_STRING: recorder->string(recorder->context, value.string.c_str()); break;\n"
+	"\t\tdefault: recorder->null(recorder->context); break;\n"
+	"\t}\n"
+	"}\n";
+
+static const char* EXECUTABLE_DEFINITION =
+	"#ifdef ENTROPIA_EXECUTABLE\n"
+	"static void print_number(void*, double value) { std::cout << value << std::endl; }\n"
+	"static void print_boolean(void*, bool value) { std::cout << (value ? \"true\" : \"false\") << std::endl; }\n"
+	"static void print_character(void*, char value) { std::cout << \"'\" << value << \"'\" << std::endl; }\n"
+	"static void print_string(void*, const char* value) { std::cout << \"\\\"\" << value << \"\\\"\" << std::endl; }\n"
+	"static void print_null(void*) { std::cout << \"null\" << std::endl; }\n"
+	"\n"
+	"int main() {\n"
+	"\tentropia_recorder recorder = { &print_number, &print_boolean, &print_character, &print_string, &print_null, nullptr };\n"
+	"\ttry {\n"
+	"\t\tentropia_run(&recorder);\n"
+	"\t} catch(const std::exception& error) {\n"
+	"\t\tstd::cerr << error.what() << std::endl;\n"
+	"\t\treturn 1;\n"
+	"\t}\n"
+	"\treturn 0;\n"
+	"}\n"
+	"#endif\n";
+
+static std::string format_number(double value) {
+	if(std::isnan(value)) {
+		return "std::numeric_limits<double>::quiet_NaN()";
+	}
+	if(std::isinf(value)) {
+		return value > 0 ? "std::numeric_limits<double>::infinity()" : "(-std::numeric_limits<double>::infinity())";
+	}
+	// Exact, hexadecimal floating literal
+	std::ostringstream stream;
+	stream << std::hexfloat << value;
+	return "(" + stream.str() + ")";
+}
+
+static std::string format_string(std::string value) {
+	std::string literal = "std::string(\"";
+	for(char c : value) {
+		if(std::isalnum(static_cast<unsigned char>(c)) || c == ' ' || c == '_') {
+			literal += c;
+		} else {
+			char escape[5];
+			std::snprintf(escape, sizeof(escape), "\\%03o", static_cast<unsigned char>(c));
+			literal += escape;
+		}
+	}
+	return literal + "\", " + std::to_string(value.size()) + ")";
+}
+
+static std::string quote_argument(std::string argument) {
+	std::string quoted = "'";
+	for(char c : argument) {
+		quoted += c == '\'' ? std::string("'\\''") : std::string(1, c);
+	}
+	return quoted + "'";
+}
+
+daedalus::entropia::compiler::SourceGenerator::SourceGenerator() :
+	temporaryCount(0),
+	loopDepth(0),
+	scopes()
+{}
+
+std::string daedalus::entropia::compiler::SourceGenerator::get_c_type(std::string type) {
+	if(type == daedalus::entropia::checker::NO_TYPE) {
+		return "";
+	}
+	// Every number shares the double of the NumberValue
+	if(daedalus::entropia::checker::is_number_type(type)) {
+		return "double";
+	}
+	if(type == "bool") {
+		return "bool";
+	}
+	if(type == "char") {
+		return "char";
+	}
+	if(type == "str") {
+		return "std::string";
+	}
+	// Tagged, a loop whose body and or values have different types
+	if(type == daedalus::entropia::checker::MIXED_TYPE) {
+		return "entropia_value";
+	}
+	throw std::runtime_error("Trying to compile value of type \"" + type + "\"");
+}
+
+std::string daedalus::entropia::compiler::SourceGenerator::get_value_type(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		return daedalus::entropia::checker::NUMBER_TYPE;
+	}
+	if(type == "BooleanExpression") {
+		return "bool";
+	}
+	if(type == "CharExpression") {
+		return "char";
+	}
+	if(type == "StrExpression") {
+		return "str";
+	}
+	if(auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression)) {
+		return identifier->get_static_type();
+	}
+	if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		return unaryExpression->get_static_type();
+	}
+	if(auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression)) {
+		return binaryExpression->get_static_type();
+	}
+	if(auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression)) {
+		return assignationExpression->get_static_type();
+	}
+	if(auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression)) {
+		return this->get_value_type(orExpression->get_value());
+	}
+	if(auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression)) {
+		return loopExpression->get_static_type();
+	}
+	if(auto conditionnalStructure = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)) {
+		return conditionnalStructure->get_static_type();
+	}
+	return daedalus::entropia::checker::NO_TYPE;
+}
+
+std::string daedalus::entropia::compiler::SourceGenerator::get_truthiness(std::string value, std::string type) {
+	std::string cType = this->get_c_type(type);
+	if(cType == "double") {
+		return "(" + value + " != 0)";
+	}
+	if(cType == "char") {
+		return "(" + value + " != '\\0')";
+	}
+	if(cType == "std::string") {
+		return "(!" + value + ".empty())";
+	}
+	if(cType == "entropia_value") {
+		return "entropia_truthy(" + value + ")";
+	}
+	return "static_cast<bool>(" + value + ")";
+}
+
+std::string daedalus::entropia::compiler::SourceGenerator::make_temporary(std::string type, std::string& out, int indent) {
+	std::string cType = this->get_c_type(type);
+	DAE_ASSERT_TRUE(
+		!cType.empty(),
+		std::runtime_error("Trying to compile the value of a statement without value")
+	)
+	std::string name = "t_" + std::to_string(this->temporaryCount++);
+	out += std::string(indent, '\t') + cType + " " + name + " = " + cType + "();\n";
+	return name;
+}
+
+bool daedalus::entropia::compiler::SourceGenerator::is_mutable(std::string name) {
+	for(auto scope = this->scopes.rbegin(); scope != this->scopes.rend(); scope++) {
+		auto binding = scope->find(name);
+		if(binding != scope->end()) {
+			return binding->second;
+		}
+	}
+	throw std::runtime_error("Trying to access undeclared value \"" + name + "\"");
+}
+
+void daedalus::entropia::compiler::SourceGenerator::emit_assignment(const daedalus::entropia::compiler::ValueTarget& target, std::string value, std::string type, std::string& out, int indent) {
+	if(target.name.empty() || type == daedalus::entropia::checker::NO_TYPE) {
+		return;
+	}
+	// A mixed value takes the value of any type, tagged by its static type (a && / || gives an int in C++)
+	if(target.type == daedalus::entropia::checker::MIXED_TYPE && type != daedalus::entropia::checker::MIXED_TYPE) {
+		out += std::string(indent, '\t') + target.name + " = entropia_value(static_cast<" + this->get_c_type(type) + ">(" + value + "));\n";
+		return;
+	}
+	// The checker types a scope by its last statement, the values of another type can't be the value of the scope
+	if(this->get_c_type(target.type) != this->get_c_type(type)) {
+		return;
+	}
+	out += std::string(indent, '\t') + target.name + " = " + value + ";\n";
+}
+
+std::string daedalus::entropia::compiler::SourceGenerator::emit_value(std::shared_ptr<daedalus::core::ast::Expression> expression, std::string& out, int indent) {
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		return format_number(std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)->get_value());
+	}
+	if(type == "BooleanExpression") {
+		return std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)->get_value() ? "true" : "false";
+	}
+	if(type == "CharExpression") {
+		return "static_cast<char>(" + std::to_string(static_cast<int>(std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(expression)->get_value())) + ")";
+	}
+	if(type == "StrExpression") {
+		return format_string(std::dynamic_pointer_cast<daedalus::entropia::ast::StrExpression>(expression)->get_value());
+	}
+	if(type == "Identifier") {
+		// Prefixed, the Entropia names can be C++ keywords
+		return "v_" + std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression)->get_name();
+	}
+	if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		DAE_ASSERT_TRUE(
+			unaryExpression->get_operator_symbol() == "!",
+			std::runtime_error("Unknown unary operator " + unaryExpression->get_operator_symbol())
+		)
+		std::string term = this->emit_value(unaryExpression->get_term(), out, indent);
+		return "(!" + this->get_truthiness(term, this->get_value_type(unaryExpression->get_term())) + ")";
+	}
+	if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		std::string left = this->emit_value(binaryExpression->get_left(), out, indent);
+		std::string leftType = this->get_value_type(binaryExpression->get_left());
+
+		// The left operand is evaluated first, before the statements computing the right one
+		std::string rightOut = "";
+		std::string right = this->emit_value(binaryExpression->get_right(), rightOut, indent);
+		if(!rightOut.empty()) {
+			std::string temporary = this->make_temporary(leftType, out, indent);
+			out += std::string(indent, '\t') + temporary + " = " + left + ";\n" + rightOut;
+			left = temporary;
+		}
+		std::string rightType = this->get_value_type(binaryExpression->get_right());
+
+		std::string operator_symbol = binaryExpression->get_operator_symbol();
+		if(operator_symbol == "/") {
+			return "entropia_divide(" + left + ", " + right + ")";
+		}
+		if(operator_symbol == "&&" || operator_symbol == "||") {
+			// Both operands are evaluated, as in the interpreter
+			return
+				"(" + this->get_truthiness(left, leftType) +
+				(operator_symbol == "&&" ? " & " : " | ") +
+				this->get_truthiness(right, rightType) + ")";
+		}
+		if(
+			operator_symbol == "+" || operator_symbol == "-" || operator_symbol == "*" ||
+			operator_symbol == "==" || operator_symbol == "!=" ||
+			operator_symbol == "<" || operator_symbol == ">" || operator_symbol == "<=" || operator_symbol == ">="
+		) {
+			return "(" + left + " " + operator_symbol + " " + right + ")";
+		}
+		throw std::runtime_error("Unknown operator " + operator_symbol);
+	}
+
+	// Statements, computed in a temporary
+	std::string temporary = this->make_temporary(this->get_value_type(expression), out, indent);
+	this->emit_statement(expression, daedalus::entropia::compiler::ValueTarget{ temporary, this->get_value_type(expression) }, out, indent);
+	return temporary;
+}
+
+void daedalus::entropia::compiler::SourceGenerator::emit_statement(std::shared_ptr<daedalus::core::ast::Expression> expression, const daedalus::entropia::compiler::ValueTarget& target, std::string& out, int indent) {
+	std::string type = expression->type();
+	std::string tabs = std::string(indent, '\t');
+
+	if(type == "BreakExpression" || type == "ContinueExpression") {
+		DAE_ASSERT_TRUE(
+			this->loopDepth > 0,
+			std::runtime_error("Trying to compile " + expression->repr() + " outside of a loop")
+		)
+		// The loop keeps the value of the statement before
+		out += tabs + (type == "BreakExpression" ? "break;\n" : "continue;\n");
+		return;
+	}
+	if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		std::string name = declarationExpression->get_identifier()->get_name();
+		std::string cType = this->get_c_type(declarationExpression->get_value_type());
+		// Through a temporary, the value can read a shadowed value of the same name
+		std::string value = this->emit_value(declarationExpression->get_value(), out, indent);
+		std::string temporary = "t_" + std::to_string(this->temporaryCount++);
+		out += tabs + cType + " " + temporary + " = " + value + ";\n";
+		out += tabs + cType + " v_" + name + " = " + temporary + ";\n";
+		this->scopes.back()[name] = declarationExpression->get_mutability();
+		this->emit_assignment(target, "v_" + name, declarationExpression->get_value_type(), out, indent);
+		return;
+	}
+	if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		std::string name = assignationExpression->get_identifier()->get_name();
+		std::string value = this->emit_value(assignationExpression->get_value(), out, indent);
+		if(!this->is_mutable(name)) {
+			// Only an error once executed, as in the interpreter
+			out += tabs + "(void)(" + value + ");\n";
+			out += tabs + "entropia_fail(" + format_string("Trying to assign to immutable value \"" + name + "\"") + ".c_str());\n";
+			return;
+		}
+		out += tabs + "v_" + name + " = " + value + ";\n";
+		this->emit_assignment(target, "v_" + name, assignationExpression->get_static_type(), out, indent);
+		return;
+	}
+	if(type == "OrExpression") {
+		this->emit_statement(std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression)->get_value(), target, out, indent);
+		return;
+	}
+	// A par for runs serially, its reductions being plain updates of the outer values
+	if(type == "LoopExpression" || type == "WhileExpression" || type == "ForExpression" || type == "ParallelForExpression") {
+		this->emit_loop(std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression), target, out, indent);
+		return;
+	}
+	if(type == "ConditionnalStructure") {
+		this->emit_conditionnal_expressions(
+			std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)->get_expressions(),
+			0,
+			target,
+			out,
+			indent
+		);
+		return;
+	}
+	if(type == "LazyScope") {
+		throw std::runtime_error("Trying to compile a lazy scope, the native backend needs the strict mode");
+	}
+
+	std::string value = this->emit_value(expression, out, indent);
+	if(target.name.empty()) {
+		out += tabs + "(void)(" + value + ");\n";
+		return;
+	}
+	this->emit_assignment(target, value, this->get_value_type(expression), out, indent);
+}
+
+void daedalus::entropia::compiler::SourceGenerator::emit_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body, const daedalus::entropia::compiler::ValueTarget& target, std::string& out, int indent) {
+	this->scopes.push_back(std::unordered_map<std::string, bool>());
+	// Every statement gives its value, a nested break / continue keeps the value of the last statement run
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		this->emit_statement(expression, target, out, indent);
+	}
+	this->scopes.pop_back();
+}
+
+void daedalus::entropia::compiler::SourceGenerator::emit_loop(std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression, const daedalus::entropia::compiler::ValueTarget& target, std::string& out, int indent) {
+	auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(loopExpression);
+	auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(loopExpression);
+	std::string tabs = std::string(indent, '\t');
+
+	// The or value is used when the body never ran
+	std::string ran = "t_" + std::to_string(this->temporaryCount++);
+	out += tabs + "bool " + ran + " = false;\n";
+	out += tabs + "{\n";
+
+	this->scopes.push_back(std::unordered_map<std::string, bool>());
+	if(forExpression != nullptr) {
+		this->emit_statement(forExpression->get_initial_expression(), daedalus::entropia::compiler::ValueTarget{ "", daedalus::entropia::checker::NO_TYPE }, out, indent + 1);
+	}
+
+	out += tabs + "\tfor(;;) {\n";
+	if(whileExpression != nullptr) {
+		std::string condition = this->emit_value(whileExpression->get_condition(), out, indent + 2);
+		out += tabs + "\t\tif(!" + this->get_truthiness(condition, this->get_value_type(whileExpression->get_condition())) + ") {\n";
+		out += tabs + "\t\t\tbreak;\n";
+		out += tabs + "\t\t}\n";
+	}
+	out += tabs + "\t\t" + ran + " = true;\n";
+
+	// The update expression runs as the last statement of the body, skipped by continue as in the interpreter
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body = loopExpression->get_body();
+	if(forExpression != nullptr) {
+		body.push_back(forExpression->get_update_expression());
+	}
+	this->loopDepth++;
+	this->emit_body(body, target, out, indent + 2);
+	this->loopDepth--;
+
+	out += tabs + "\t}\n";
+	this->scopes.pop_back();
+	out += tabs + "}\n";
+
+	if(loopExpression->get_or_expression() != nullptr) {
+		out += tabs + "if(!" + ran + ") {\n";
+		this->scopes.push_back(std::unordered_map<std::string, bool>());
+		this->emit_statement(loopExpression->get_or_expression(), target, out, indent + 1);
+		this->scopes.pop_back();
+		out += tabs + "}\n";
+	}
+}
+
+void daedalus::entropia::compiler::SourceGenerator::emit_conditionnal_expressions(
+	std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>> expressions,
+	size_t index,
+	const daedalus::entropia::compiler::ValueTarget& target,
+	std::string& out,
+	int indent
+) {
+	std::string tabs = std::string(indent, '\t');
+
+	if(index == expressions.size()) {
+		out += tabs + "entropia_fail(\"No condition matched (should not have been parsed\");\n";
+		return;
+	}
+
+	std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> expression = expressions.at(index);
+	if(expression->get_condition() == nullptr) {
+		out += tabs + "{\n";
+		this->emit_body(expression->get_body(), target, out, indent + 1);
+		out += tabs + "}\n";
+		return;
+	}
+
+	std::string condition = this->emit_value(expression->get_condition(), out, indent);
+	out += tabs + "if(" + this->get_truthiness(condition, this->get_value_type(expression->get_condition())) + ") {\n";
+	this->emit_body(expression->get_body(), target, out, indent + 1);
+	out += tabs + "} else {\n";
+	this->emit_conditionnal_expressions(expressions, index + 1, target, out, indent + 1);
+	out += tabs + "}\n";
+}
+
+std::string daedalus::entropia::compiler::SourceGenerator::generate(std::shared_ptr<daedalus::core::ast::Scope> program, uint64_t hash) {
+	this->temporaryCount = 0;
+	this->loopDepth = 0;
+	this->scopes = { std::unordered_map<std::string, bool>() };
+
+	std::string body = "";
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : program->get_body()) {
+		// Declared for the statements after it, not recorded
+		if(daedalus::entropia::ast::is_hidden(expression)) {
+			this->emit_statement(expression, daedalus::entropia::compiler::ValueTarget{ "", daedalus::entropia::checker::NO_TYPE }, body, 1);
+			continue;
+		}
+
+		std::string type = this->get_value_type(expression);
+		std::string cType = this->get_c_type(type);
+
+		// A top level break / continue only gives a null value
+		if(cType.empty() || expression->type() == "BreakExpression" || expression->type() == "ContinueExpression") {
+			if(expression->type() != "BreakExpression" && expression->type() != "ContinueExpression") {
+				this->emit_statement(expression, daedalus::entropia::compiler::ValueTarget{ "", daedalus::entropia::checker::NO_TYPE }, body, 1);
+			}
+			body += "\trecorder->null(recorder->context);\n";
+			continue;
+		}
+
+		std::string temporary = this->make_temporary(type, body, 1);
+		this->emit_statement(expression, daedalus::entropia::compiler::ValueTarget{ temporary, type }, body, 1);
+
+		if(cType == "double") {
+			body += "\trecorder->number(recorder->context, " + temporary + ");\n";
+		} else if(cType == "bool") {
+			body += "\trecorder->boolean(recorder->context, " + temporary + ");\n";
+		} else if(cType == "char") {
+			body += "\trecorder->character(recorder->context, " + temporary + ");\n";
+		} else if(cType == "entropia_value") {
+			body += "\tentropia_record(recorder, " + temporary + ");\n";
+		} else {
+			body += "\trecorder->string(recorder->context, " + temporary + ".c_str());\n";
+		}
+	}
+
+	std::ostringstream hashLiteral;
+	hashLiteral << "0x" << std::hex << hash << "ULL";
+
+	return
+		std::string("// Generated by Daedalus Entropia, do not edit\n\n") +
+		"#include <cstdint>\n"
+		"#include <iostream>\n"
+		"#include <limits>\n"
+		"#include <stdexcept>\n"
+		"#include <string>\n\n" +
+		RECORDER_DEFINITION + "\n" +
+		RUNTIME_DEFINITION + "\n" +
+		"extern \"C\" const uint64_t entropia_source_hash = " + hashLiteral.str() + ";\n\n" +
+		"extern \"C\" void entropia_run(entropia_recorder* recorder) {\n" +
+		body +
+		"}\n\n" +
+		EXECUTABLE_DEFINITION;
+}
+
+void daedalus::entropia::compiler::build(std::string source, std::string output, daedalus::entropia::compiler::BuildKind kind) {
+#ifdef _WIN32
+	throw std::runtime_error("The native backend is only supported on POSIX systems");
+#else
+	std::string sourcePath = output + ".cpp";
+	std::ofstream file = std::ofstream(sourcePath, std::ios::binary | std::ios::trunc);
+	DAE_ASSERT_TRUE(
+		file.is_open(),
+		std::runtime_error("Failed to write the native sources " + sourcePath)
+	)
+	file << source;
+	file.close();
+
+	const char* compiler = std::getenv("CXX");
+	// The shared object is replaced at once, a running program could load it
+	std::string buildPath = kind == daedalus::entropia::compiler::BuildKind::SHARED_OBJECT ? output + ".tmp" : output;
+	std::string command =
+		std::string(compiler != nullptr && compiler[0] != '\0' ? compiler : "c++") +
+		" -std=c++17 -O2" +
+		(kind == daedalus::entropia::compiler::BuildKind::SHARED_OBJECT ? " -shared -fPIC" : " -DENTROPIA_EXECUTABLE") +
+		" -o " + quote_argument(buildPath) +
+		" " + quote_argument(sourcePath);
+
+	DAE_DEBUG_LOG("NATIVE BUILD " + command)
+
+	// The sources are kept on failure to inspect them
+	DAE_ASSERT_TRUE(
+		std::system(command.c_str()) == 0,
+		std::runtime_error("Failed to build the native program: " + command)
+	)
+	(void)std::remove(sourcePath.c_str());
+
+	if(buildPath != output) {
+		DAE_ASSERT_TRUE(
+			std::rename(buildPath.c_str(), output.c_str()) == 0,
+			std::runtime_error("Failed to move the native program to " + output)
+		)
+	}
+#endif
+}
+
+std::string daedalus::entropia::compiler::get_library_path(std::string cache_path) {
+	size_t extension = cache_path.rfind(".entc");
+	return (extension == std::string::npos ? cache_path : cache_path.substr(0, extension)) + ".so";
+}
+
+#ifndef _WIN32
+
+struct RecorderContext {
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body;
+	std::vector<daedalus::core::interpreter::RuntimeResult>& results;
+};
+
+// Same representation as the interpreted values
+static void record_value(void* context, std::shared_ptr<daedalus::core::values::RuntimeValue> value) {
+	auto* recorderContext = static_cast<RecorderContext*>(context);
+	recorderContext->results.push_back({
+		recorderContext->body.at(recorderContext->results.size())->repr(),
+		value->repr()
+	});
+}
+
+static void record_number(void* context, double value) {
+	record_value(context, daedalus::entropia::values::get_number(value));
+}
+
+static void record_boolean(void* context, bool value) {
+	record_value(context, daedalus::entropia::values::get_boolean(value));
+}
+
+static void record_character(void* context, char value) {
+	record_value(context, daedalus::entropia::values::get_char(value));
+}
+
+static void record_string(void* context, const char* value) {
+	record_value(context, std::make_shared<daedalus::entropia::values::StrValue>(value));
+}
+
+static void record_null(void* context) {
+	record_value(context, daedalus::entropia::values::get_null());
+}
+
+#endif
+
+bool daedalus::entropia::compiler::run_library(
+	std::string path,
+	uint64_t hash,
+	std::shared_ptr<daedalus::core::ast::Scope> program,
+	std::vector<daedalus::core::interpreter::RuntimeResult>& results
+) {
+#ifdef _WIN32
+	throw std::runtime_error("The native backend is only supported on POSIX systems");
+#else
+	// Without a slash, dlopen would search the library path instead
+	if(path.find('/') == std::string::npos) {
+		path = "./" + path;
+	}
+
+	void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if(library == nullptr) {
+		return false;
+	}
+
+	const auto* sourceHash = static_cast<const uint64_t*>(dlsym(library, "entropia_source_hash"));
+	auto run = reinterpret_cast<void (*)(entropia_recorder*)>(dlsym(library, "entropia_run"));
+	if(sourceHash == nullptr || run == nullptr || *sourceHash != hash) {
+		dlclose(library);
+		return false;
+	}
+
+	// The results are recorded in a copy, a failing program doesn't leave partial results
+	auto nativeResults = std::vector<daedalus::core::interpreter::RuntimeResult>();
+	// One recorded value per statement, the hidden declarations aside
+	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : program->get_body()) {
+		if(!daedalus::entropia::ast::is_hidden(expression)) {
+			body.push_back(expression);
+		}
+	}
+	RecorderContext context = RecorderContext{ body, nativeResults };
+	entropia_recorder recorder = entropia_recorder{ &record_number, &record_boolean, &record_character, &record_string, &record_null, &context };
+
+	try {
+		run(&recorder);
+	} catch(...) {
+		dlclose(library);
+		throw;
+	}
+	dlclose(library);
+
+	results.insert(results.end(), nativeResults.begin(), nativeResults.end());
+	return true;
+#endif
+}
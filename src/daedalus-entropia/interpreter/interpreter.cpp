@@ -18,7 +18,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 ) {
 	auto booleanExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(statement);
 	return daedalus::core::interpreter::wrap(
-	   std::make_shared<daedalus::entropia::values::BooleanValue>(booleanExpression->get_value())
+	   daedalus::entropia::values::get_boolean(booleanExpression->get_value())
 	);
 };
 
@@ -29,7 +29,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 ) {
 	auto charExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(statement);
 	return daedalus::core::interpreter::wrap(
-	   std::make_shared<daedalus::entropia::values::CharValue>(charExpression->get_value())
+	   daedalus::entropia::values::get_char(charExpression->get_value())
 	);
 };
 
@@ -40,7 +40,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 ) {
 	auto strExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::StrExpression>(statement);
 	return daedalus::core::interpreter::wrap(
-	   std::make_shared<daedalus::entropia::values::StrValue>(strExpression->get_value())
+	   strExpression->get_runtime_value()
 	);
 };
 
@@ -56,13 +56,216 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 
 	if(operator_symbol == "!") {
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::entropia::values::BooleanValue>(!term.value->IsTrue())
+		   daedalus::entropia::values::get_boolean(!term.value->IsTrue())
 		);
 	}
 
 	throw std::runtime_error("Unknown unary operator " + operator_symbol);
 }
 
+daedalus::core::interpreter::RuntimeResult daedalus::entropia::interpreter::LazyResult::get() const {
+	return {
+		this->statement->repr(),
+		this->value != nullptr ? this->value->repr() : "null"
+	};
+}
+
+daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter::evaluate_body(
+	daedalus::core::interpreter::Interpreter& interpreter,
+	std::shared_ptr<daedalus::core::ast::Scope> scope,
+	std::shared_ptr<daedalus::core::env::Environment> scope_env,
+	std::shared_ptr<daedalus::core::env::Environment> parent_env
+) {
+	if(scope_env == nullptr) {
+		scope_env = std::allocate_shared<daedalus::core::env::Environment>(
+			daedalus::entropia::stats::CountingAllocator<daedalus::core::env::Environment>(),
+			interpreter.envValuesProperties,
+			interpreter.validationRules,
+			parent_env
+		);
+	}
+
+	daedalus::core::interpreter::RuntimeValueWrapper last = daedalus::core::interpreter::wrap(nullptr);
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : scope->get_body()) {
+		daedalus::entropia::stats::count_statement();
+		daedalus::core::interpreter::RuntimeValueWrapper result = daedalus::core::interpreter::evaluate_statement(interpreter, expression, scope_env);
+		if(result.shouldReturn) {
+			// A bare break / continue gives the value of the statement before it
+			if(last.value != nullptr && result.value != nullptr && result.value->type() == "NullValue") {
+				result.value = last.value;
+			}
+			return result;
+		}
+		last = result;
+	}
+	return last;
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::interpreter::interpret(
+	daedalus::core::interpreter::Interpreter& interpreter,
+	std::shared_ptr<daedalus::core::ast::Scope> program,
+	std::vector<daedalus::entropia::interpreter::LazyResult>* results,
+	std::shared_ptr<daedalus::core::env::Environment> parent_env
+) {
+	auto env = std::allocate_shared<daedalus::core::env::Environment>(
+		daedalus::entropia::stats::CountingAllocator<daedalus::core::env::Environment>(),
+		interpreter.envValuesProperties,
+		interpreter.validationRules,
+		parent_env
+	);
+
+	std::shared_ptr<daedalus::core::values::RuntimeValue> last = nullptr;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : program->get_body()) {
+		daedalus::entropia::stats::count_statement();
+		std::shared_ptr<daedalus::core::values::RuntimeValue> value = daedalus::core::interpreter::evaluate_statement(interpreter, expression, env).value;
+		// Run for the statements after it, but not a result of the program
+		if(daedalus::entropia::ast::is_hidden(expression)) {
+			continue;
+		}
+		last = value;
+		if(results != nullptr) {
+			results->push_back({ expression, last });
+		}
+	}
+	return last;
+}
+
+#pragma region Quickening
+
+struct Divide {
+	double operator()(double left, double right) const {
+		DAE_ASSERT_TRUE(
+			right != 0,
+			std::runtime_error("Trying to divide by zero");
+		)
+		return left / right;
+	}
+};
+
+// The arithmetic operations give a number, the comparisons a boolean
+static std::shared_ptr<daedalus::core::values::RuntimeValue> get_result_value(double value) {
+	return daedalus::entropia::values::get_number(value);
+}
+static std::shared_ptr<daedalus::core::values::RuntimeValue> get_result_value(bool value) {
+	return daedalus::entropia::values::get_boolean(value);
+}
+
+// Guarded by the exact operand classes, no type string is built
+template<typename Value, typename Operation>
+static std::shared_ptr<daedalus::core::values::RuntimeValue> quickened_operation(
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& left,
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& right
+) {
+	if(typeid(*left) != typeid(Value) || typeid(*right) != typeid(Value)) {
+		return nullptr;
+	}
+	return get_result_value(
+		Operation()(static_cast<Value*>(left.get())->get(), static_cast<Value*>(right.get())->get())
+	);
+}
+
+template<bool isAnd>
+static std::shared_ptr<daedalus::core::values::RuntimeValue> quickened_logical_operation(
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& left,
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& right
+) {
+	return daedalus::entropia::values::get_boolean(
+		isAnd ? left->IsTrue() && right->IsTrue() : left->IsTrue() || right->IsTrue()
+	);
+}
+
+template<bool isEqual>
+static std::shared_ptr<daedalus::core::values::RuntimeValue> quickened_string_equality(
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& left,
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& right
+) {
+	typedef daedalus::entropia::values::StrValue StrValue;
+	if(typeid(*left) != typeid(StrValue) || typeid(*right) != typeid(StrValue)) {
+		return nullptr;
+	}
+	return daedalus::entropia::values::get_boolean(
+		static_cast<StrValue*>(left.get())->equals(*static_cast<StrValue*>(right.get())) == isEqual
+	);
+}
+
+template<typename Value, typename Type>
+static daedalus::entropia::ast::QuickenedOperation get_equality_operation(std::string operator_symbol) {
+	if(operator_symbol == "==") {
+		return &quickened_operation<Value, std::equal_to<Type>>;
+	}
+	if(operator_symbol == "!=") {
+		return &quickened_operation<Value, std::not_equal_to<Type>>;
+	}
+	return nullptr;
+}
+
+/**
+ * Operation specialized on the operator and the operand classes, nullptr when the generic path must report an error
+ */
+static daedalus::entropia::ast::QuickenedOperation get_quickened_operation(
+	std::string operator_symbol,
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& left,
+	const std::shared_ptr<daedalus::core::values::RuntimeValue>& right
+) {
+	if(operator_symbol == "&&") {
+		return &quickened_logical_operation<true>;
+	}
+	if(operator_symbol == "||") {
+		return &quickened_logical_operation<false>;
+	}
+	if(typeid(*left) != typeid(*right)) {
+		return nullptr;
+	}
+
+	if(typeid(*left) == typeid(daedalus::core::values::NumberValue)) {
+		typedef daedalus::core::values::NumberValue NumberValue;
+
+		if(operator_symbol == "+") {
+			return &quickened_operation<NumberValue, std::plus<double>>;
+		}
+		if(operator_symbol == "-") {
+			return &quickened_operation<NumberValue, std::minus<double>>;
+		}
+		if(operator_symbol == "*") {
+			return &quickened_operation<NumberValue, std::multiplies<double>>;
+		}
+		if(operator_symbol == "/") {
+			return &quickened_operation<NumberValue, Divide>;
+		}
+		if(operator_symbol == "<") {
+			return &quickened_operation<NumberValue, std::less<double>>;
+		}
+		if(operator_symbol == ">") {
+			return &quickened_operation<NumberValue, std::greater<double>>;
+		}
+		if(operator_symbol == "<=") {
+			return &quickened_operation<NumberValue, std::less_equal<double>>;
+		}
+		if(operator_symbol == ">=") {
+			return &quickened_operation<NumberValue, std::greater_equal<double>>;
+		}
+		return get_equality_operation<NumberValue, double>(operator_symbol);
+	}
+	if(typeid(*left) == typeid(daedalus::entropia::values::BooleanValue)) {
+		return get_equality_operation<daedalus::entropia::values::BooleanValue, bool>(operator_symbol);
+	}
+	if(typeid(*left) == typeid(daedalus::entropia::values::CharValue)) {
+		return get_equality_operation<daedalus::entropia::values::CharValue, char>(operator_symbol);
+	}
+	if(typeid(*left) == typeid(daedalus::entropia::values::StrValue)) {
+		if(operator_symbol == "==") {
+			return &quickened_string_equality<true>;
+		}
+		if(operator_symbol == "!=") {
+			return &quickened_string_equality<false>;
+		}
+		return nullptr;
+	}
+	return nullptr;
+}
+
+#pragma endregion
+
 daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter::evaluate_binary_expression(
 	daedalus::core::interpreter::Interpreter& interpreter,
 	std::shared_ptr<daedalus::core::ast::Statement> statement,
@@ -73,8 +276,26 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	daedalus::core::interpreter::RuntimeValueWrapper left = daedalus::core::interpreter::evaluate_statement(interpreter, binaryExpression->get_left(), env);
 	daedalus::core::interpreter::RuntimeValueWrapper right = daedalus::core::interpreter::evaluate_statement(interpreter, binaryExpression->get_right(), env);
 
+	// Quickened after the first evaluation, the operand types of a node don't change
+	daedalus::entropia::ast::QuickenedOperation quickenedOperation = binaryExpression->get_quickened_operation();
+	if(quickenedOperation != nullptr) {
+		std::shared_ptr<daedalus::core::values::RuntimeValue> value = quickenedOperation(left.value, right.value);
+		if(value != nullptr) {
+			return daedalus::core::interpreter::wrap(value);
+		}
+		binaryExpression->deoptimize();
+	}
+
 	std::string operator_symbol = binaryExpression->get_operator_symbol();
 
+	if(!binaryExpression->is_deoptimized()) {
+		quickenedOperation = get_quickened_operation(operator_symbol, left.value, right.value);
+		if(quickenedOperation != nullptr) {
+			binaryExpression->quicken(quickenedOperation);
+			return daedalus::core::interpreter::wrap(quickenedOperation(left.value, right.value));
+		}
+	}
+
 	if(operator_symbol == "+") {
 		DAE_ASSERT_TRUE(
 			left.value->type() == "NumberValue" &&
@@ -86,7 +307,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::core::values::NumberValue>(left_nb + right_nb)
+		   daedalus::entropia::values::get_number(left_nb + right_nb)
 		);
 	}
 	if(operator_symbol == "-") {
@@ -100,7 +321,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::core::values::NumberValue>(left_nb - right_nb)
+		   daedalus::entropia::values::get_number(left_nb - right_nb)
 		);
 	}
 	if(operator_symbol == "*") {
@@ -114,7 +335,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::core::values::NumberValue>(left_nb * right_nb)
+		   daedalus::entropia::values::get_number(left_nb * right_nb)
 		);
 	}
 	if(operator_symbol == "/") {
@@ -133,7 +354,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 		)
 
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::core::values::NumberValue>(left_nb / right_nb)
+		   daedalus::entropia::values::get_number(left_nb / right_nb)
 		);
 	}
 	if(operator_symbol == "==") {
@@ -145,7 +366,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb == right_nb)
+                daedalus::entropia::values::get_boolean(left_nb == right_nb)
             );
 		}
         if(
@@ -156,7 +377,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		bool right_bool = std::dynamic_pointer_cast<daedalus::entropia::values::BooleanValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_bool == right_bool)
+                daedalus::entropia::values::get_boolean(left_bool == right_bool)
             );
 		}
 		if(
@@ -167,18 +388,18 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		char right_char = std::dynamic_pointer_cast<daedalus::entropia::values::CharValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_char == right_char)
+                daedalus::entropia::values::get_boolean(left_char == right_char)
             );
         }
         if(
       		left.value->type() == "StrValue" &&
       		right.value->type() == "StrValue"
 		) {
-            std::string left_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(left.value)->get();
-      		std::string right_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(right.value)->get();
+            auto left_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(left.value);
+      		auto right_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(right.value);
 
       		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_str == right_str)
+                daedalus::entropia::values::get_boolean(left_str->equals(*right_str))
             );
         }
 
@@ -193,7 +414,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb != right_nb)
+                daedalus::entropia::values::get_boolean(left_nb != right_nb)
             );
 		}
         if(
@@ -204,7 +425,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		bool right_bool = std::dynamic_pointer_cast<daedalus::entropia::values::BooleanValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_bool != right_bool)
+                daedalus::entropia::values::get_boolean(left_bool != right_bool)
             );
 		}
 		if(
@@ -215,18 +436,18 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		char right_char = std::dynamic_pointer_cast<daedalus::entropia::values::CharValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_char != right_char)
+                daedalus::entropia::values::get_boolean(left_char != right_char)
             );
         }
         if(
       		left.value->type() == "StrValue" &&
       		right.value->type() == "StrValue"
 		) {
-            std::string left_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(left.value)->get();
-      		std::string right_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(right.value)->get();
+            auto left_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(left.value);
+      		auto right_str = std::dynamic_pointer_cast<daedalus::entropia::values::StrValue>(right.value);
 
       		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_str != right_str)
+                daedalus::entropia::values::get_boolean(!left_str->equals(*right_str))
             );
         }
 
@@ -241,7 +462,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb < right_nb)
+                daedalus::entropia::values::get_boolean(left_nb < right_nb)
             );
 		}
 
@@ -256,7 +477,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb > right_nb)
+                daedalus::entropia::values::get_boolean(left_nb > right_nb)
             );
 		}
 
@@ -271,13 +492,13 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb != right_nb)
+                daedalus::entropia::values::get_boolean(left_nb <= right_nb)
             );
 		}
 
 		throw std::runtime_error("Trying to check equality/inferiority on invalid invalid operands : " + left.value->type() + " != " + right.value->type());
 	}
-	if(operator_symbol == "!=") {
+	if(operator_symbol == ">=") {
         if(
     		left.value->type() == "NumberValue" &&
     		right.value->type() == "NumberValue"
@@ -286,7 +507,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     		double right_nb = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right.value)->get();
 
     		return daedalus::core::interpreter::wrap(
-                std::make_shared<daedalus::entropia::values::BooleanValue>(left_nb != right_nb)
+                daedalus::entropia::values::get_boolean(left_nb >= right_nb)
             );
 		}
 
@@ -294,12 +515,12 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	}
 	if(operator_symbol == "&&") {
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::entropia::values::BooleanValue>(left.value->IsTrue() && right.value->IsTrue())
+		   daedalus::entropia::values::get_boolean(left.value->IsTrue() && right.value->IsTrue())
 		);
 	}
 	if(operator_symbol == "||") {
 		return daedalus::core::interpreter::wrap(
-		   std::make_shared<daedalus::entropia::values::BooleanValue>(left.value->IsTrue() || right.value->IsTrue())
+		   daedalus::entropia::values::get_boolean(left.value->IsTrue() || right.value->IsTrue())
 		);
 	}
 
@@ -355,15 +576,14 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(statement);
 
     daedalus::core::interpreter::RuntimeValueWrapper scope_result = daedalus::core::interpreter::wrap(nullptr);
-	while(true) {
-	    auto results = std::vector<daedalus::core::interpreter::RuntimeResult>();
-		scope_result = daedalus::core::interpreter::evaluate_scope(
+    daedalus::entropia::region::Region region;
+	while(!daedalus::entropia::jit::run_hot_loop(loopExpression, env, scope_result)) {
+	    region.next_iteration();
+		scope_result = daedalus::entropia::interpreter::evaluate_body(
 		    interpreter,
 			loopExpression,
-			results,
 			nullptr,
-			env,
-			static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+			env
 		);
 
         if(
@@ -397,7 +617,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	}
 
 	if(scope_result.value == nullptr) {
-	    scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, loopExpression->get_or_expression(), env);
+	    scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, loopExpression->get_or_expression()->get_value(), env);
 	}
 
 	return scope_result;
@@ -411,15 +631,17 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
     auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(statement);
 
     daedalus::core::interpreter::RuntimeValueWrapper scope_result = daedalus::core::interpreter::wrap(nullptr);
-	while(daedalus::core::interpreter::evaluate_statement(interpreter, whileExpression->get_condition(), env).value->IsTrue()) {
-	    auto results = std::vector<daedalus::core::interpreter::RuntimeResult>();
-		scope_result = daedalus::core::interpreter::evaluate_scope(
+    daedalus::entropia::region::Region region;
+	while(
+	    !daedalus::entropia::jit::run_hot_loop(whileExpression, env, scope_result) &&
+	    daedalus::core::interpreter::evaluate_statement(interpreter, whileExpression->get_condition(), env).value->IsTrue()
+	) {
+	    region.next_iteration();
+		scope_result = daedalus::entropia::interpreter::evaluate_body(
 		    interpreter,
 			whileExpression,
-			results,
 			nullptr,
-			env,
-			static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+			env
 		);
 
         if(
@@ -453,7 +675,81 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	}
 
 	if(scope_result.value == nullptr) {
-	    scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, whileExpression->get_or_expression(), env);
+	    scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, whileExpression->get_or_expression()->get_value(), env);
+	}
+
+	return scope_result;
+}
+
+/**
+ * Run a canonical for loop with a native counter, the update is never evaluated
+ */
+static daedalus::core::interpreter::RuntimeValueWrapper evaluate_counted_loop(
+	daedalus::core::interpreter::Interpreter& interpreter,
+	std::shared_ptr<daedalus::entropia::ast::ForExpression> forExpression,
+	std::shared_ptr<daedalus::core::env::Environment> for_env,
+	std::shared_ptr<daedalus::core::env::Environment> env
+) {
+	std::shared_ptr<daedalus::entropia::ast::CountedLoop> countedLoop = forExpression->get_counted_loop();
+
+	std::shared_ptr<daedalus::core::values::RuntimeValue> initialValue = for_env->get_value(countedLoop->name);
+	std::shared_ptr<daedalus::core::values::RuntimeValue> boundValue = daedalus::core::interpreter::evaluate_statement(interpreter, countedLoop->bound, for_env).value;
+	DAE_ASSERT_TRUE(
+		initialValue->type() == "NumberValue" && boundValue->type() == "NumberValue",
+		std::runtime_error("Trying to check a counted loop on invalid operands : " + initialValue->type() + " " + countedLoop->comparison + " " + boundValue->type())
+	)
+
+	double counter = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(initialValue)->get();
+	double bound = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(boundValue)->get();
+	double step = countedLoop->step;
+	bool isRead = countedLoop->isRead;
+	bool isLess = countedLoop->comparison.at(0) == '<';
+	bool isInclusive = countedLoop->comparison.size() == 2;
+
+	daedalus::core::interpreter::RuntimeValueWrapper scope_result = daedalus::core::interpreter::wrap(nullptr);
+	bool isUpdated = false;
+	daedalus::entropia::region::Region region;
+
+	while(isLess ? (isInclusive ? counter <= bound : counter < bound) : (isInclusive ? counter >= bound : counter > bound)) {
+		region.next_iteration();
+		if(isRead) {
+			for_env->set_value(countedLoop->name, daedalus::entropia::values::get_number(counter));
+		}
+
+		scope_result = daedalus::entropia::interpreter::evaluate_body(
+		    interpreter,
+			forExpression,
+			nullptr,
+			for_env
+		);
+
+		if(
+            daedalus::core::interpreter::flag_contains(
+                static_cast<daedalus::core::interpreter::Flags>(scope_result.flags),
+                static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+            )
+        ) {
+            scope_result.flags = static_cast<daedalus::core::interpreter::Flags>(
+                daedalus::core::interpreter::flag_remove(
+                    static_cast<daedalus::core::interpreter::Flags>(scope_result.flags),
+                    static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+                )
+            );
+            isUpdated = false;
+            break;
+        }
+
+		counter += step;
+		isUpdated = true;
+	}
+
+	// The update is the last statement of a complete iteration
+	if(isUpdated) {
+		scope_result = daedalus::core::interpreter::wrap(daedalus::entropia::values::get_number(counter));
+	}
+
+	if(scope_result.value == nullptr) {
+	    scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, forExpression->get_or_expression()->get_value(), env);
 	}
 
 	return scope_result;
@@ -466,26 +762,36 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 ) {
     auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(statement);
 
-    auto for_env = std::make_shared<daedalus::core::env::Environment>(
+    auto for_env = std::allocate_shared<daedalus::core::env::Environment>(
+		daedalus::entropia::stats::CountingAllocator<daedalus::core::env::Environment>(),
 		interpreter.envValuesProperties,
 		interpreter.validationRules,
 		env
 	);
 
 	daedalus::core::interpreter::evaluate_statement(interpreter, forExpression->get_initial_expression(), for_env);
-    forExpression->push_back_body(forExpression->get_update_expression());
 
-    daedalus::core::interpreter::RuntimeValueWrapper scope_result = daedalus::core::interpreter::wrap(nullptr);
+    forExpression->analyze_counted_loop([&forExpression]() {
+        return daedalus::entropia::optimizer::get_counted_loop(forExpression);
+    });
+    // With --jit, the generic loop is taken over by the JIT once hot
+    if(forExpression->get_counted_loop() != nullptr && !daedalus::entropia::jit::jitLoops) {
+        return evaluate_counted_loop(interpreter, forExpression, for_env, env);
+    }
 
-	while(daedalus::core::interpreter::evaluate_statement(interpreter, forExpression->get_condition(), for_env).value->IsTrue()) {
-	    std::vector<daedalus::core::interpreter::RuntimeResult> results = std::vector<daedalus::core::interpreter::RuntimeResult>();
-		scope_result = daedalus::core::interpreter::evaluate_scope(
+    daedalus::core::interpreter::RuntimeValueWrapper scope_result = daedalus::core::interpreter::wrap(nullptr);
+    daedalus::entropia::region::Region region;
+
+	while(
+	    !daedalus::entropia::jit::run_hot_loop(forExpression, for_env, scope_result) &&
+	    daedalus::core::interpreter::evaluate_statement(interpreter, forExpression->get_condition(), for_env).value->IsTrue()
+	) {
+	    region.next_iteration();
+		scope_result = daedalus::entropia::interpreter::evaluate_body(
 		    interpreter,
 			forExpression,
-			results,
 			nullptr,
-			for_env,
-			static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+			for_env
 		);
 
         if(
@@ -516,6 +822,9 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
             );
             continue;
         }
+
+        // Last statement of a complete iteration, the body itself is never modified so the program can run again
+        scope_result = daedalus::core::interpreter::evaluate_statement(interpreter, forExpression->get_update_expression(), for_env);
 	}
 
 	if(scope_result.value == nullptr) {
@@ -525,13 +834,191 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	return scope_result;
 }
 
+/**
+ * Number of iterations of a counted loop, whose variable only moves by whole steps
+ */
+static size_t get_iteration_count(double start, double bound, double step, std::string comparison) {
+	bool isLess = comparison.at(0) == '<';
+	bool isInclusive = comparison.size() == 2;
+	auto holds = [bound, isLess, isInclusive](double counter) {
+		return isLess ? (isInclusive ? counter <= bound : counter < bound) : (isInclusive ? counter >= bound : counter > bound);
+	};
+
+	if(!holds(start)) {
+		return 0;
+	}
+	DAE_ASSERT_TRUE(
+		isLess ? step > 0 : step < 0,
+		std::runtime_error("Trying to run a par for whose step never reaches its bound")
+	)
+
+	// Closed form, then exact on the boundary
+	size_t count = static_cast<size_t>(std::max(0.0, std::ceil((bound - start) / step)));
+	while(count > 0 && !holds(start + (count - 1) * step)) {
+		count--;
+	}
+	while(holds(start + count * step)) {
+		count++;
+	}
+	return count;
+}
+
+static std::shared_ptr<daedalus::core::values::RuntimeValue> get_reduction_identity(std::string operator_symbol) {
+	if(operator_symbol == "+") {
+		return daedalus::entropia::values::get_number(0);
+	}
+	if(operator_symbol == "*") {
+		return daedalus::entropia::values::get_number(1);
+	}
+	return daedalus::entropia::values::get_boolean(operator_symbol == "&&");
+}
+
+static std::shared_ptr<daedalus::core::values::RuntimeValue> combine_reduction(
+	std::string operator_symbol,
+	std::shared_ptr<daedalus::core::values::RuntimeValue> left,
+	std::shared_ptr<daedalus::core::values::RuntimeValue> right
+) {
+	if(operator_symbol == "&&" || operator_symbol == "||") {
+		return daedalus::entropia::values::get_boolean(
+			operator_symbol == "&&" ? left->IsTrue() && right->IsTrue() : left->IsTrue() || right->IsTrue()
+		);
+	}
+
+	DAE_ASSERT_TRUE(
+		left->type() == "NumberValue" && right->type() == "NumberValue",
+		std::runtime_error("Trying to reduce invalid operands : " + left->type() + " " + operator_symbol + " " + right->type())
+	)
+	double leftValue = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(left)->get();
+	double rightValue = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(right)->get();
+	return daedalus::entropia::values::get_number(operator_symbol == "+" ? leftValue + rightValue : leftValue * rightValue);
+}
+
+daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter::evaluate_parallel_for_expression(
+	daedalus::core::interpreter::Interpreter& interpreter,
+	std::shared_ptr<daedalus::core::ast::Statement> statement,
+	std::shared_ptr<daedalus::core::env::Environment> env
+) {
+    auto parallelForExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ParallelForExpression>(statement);
+
+    auto for_env = std::allocate_shared<daedalus::core::env::Environment>(
+		daedalus::entropia::stats::CountingAllocator<daedalus::core::env::Environment>(),
+		interpreter.envValuesProperties,
+		interpreter.validationRules,
+		env
+	);
+
+	daedalus::core::interpreter::evaluate_statement(interpreter, parallelForExpression->get_initial_expression(), for_env);
+
+    parallelForExpression->analyze_counted_loop([&parallelForExpression]() {
+        return daedalus::entropia::optimizer::get_counted_loop(parallelForExpression);
+    });
+	std::shared_ptr<daedalus::entropia::ast::CountedLoop> countedLoop = parallelForExpression->get_counted_loop();
+	DAE_ASSERT_TRUE(
+		countedLoop != nullptr,
+		std::runtime_error("Trying to run a par for that isn't counted")
+	)
+
+	std::shared_ptr<daedalus::core::values::RuntimeValue> initialValue = for_env->get_value(countedLoop->name);
+	std::shared_ptr<daedalus::core::values::RuntimeValue> boundValue = daedalus::core::interpreter::evaluate_statement(interpreter, countedLoop->bound, for_env).value;
+	DAE_ASSERT_TRUE(
+		initialValue->type() == "NumberValue" && boundValue->type() == "NumberValue",
+		std::runtime_error("Trying to check a counted loop on invalid operands : " + initialValue->type() + " " + countedLoop->comparison + " " + boundValue->type())
+	)
+
+	double start = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(initialValue)->get();
+	double step = countedLoop->step;
+	size_t iterations = get_iteration_count(
+		start,
+		std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(boundValue)->get(),
+		step,
+		countedLoop->comparison
+	);
+
+	if(iterations == 0) {
+		return daedalus::core::interpreter::evaluate_statement(interpreter, parallelForExpression->get_or_expression()->get_value(), env);
+	}
+
+	std::vector<daedalus::entropia::ast::Reduction> reductions = parallelForExpression->get_reductions();
+	size_t chunkCount = std::min(daedalus::entropia::interpreter::PARALLEL_CHUNKS, iterations);
+	auto chunkEnvs = std::vector<std::shared_ptr<daedalus::core::env::Environment>>(chunkCount);
+	auto chunkErrors = std::vector<std::exception_ptr>(chunkCount);
+
+	// The outer values are only read, each chunk writes its own environment
+	auto runChunk = [&](size_t chunk) {
+		try {
+			auto chunk_env = std::allocate_shared<daedalus::core::env::Environment>(
+				daedalus::entropia::stats::CountingAllocator<daedalus::core::env::Environment>(),
+				interpreter.envValuesProperties,
+				interpreter.validationRules,
+				for_env
+			);
+			chunk_env->init_value(countedLoop->name, initialValue, { { "isMutable", "true" } });
+			for(const daedalus::entropia::ast::Reduction& reduction : reductions) {
+				chunk_env->init_value(reduction.name, get_reduction_identity(reduction.operator_symbol), { { "isMutable", "true" } });
+			}
+			chunkEnvs.at(chunk) = chunk_env;
+
+			daedalus::entropia::region::Region region;
+			for(size_t i = chunk * iterations / chunkCount; i < (chunk + 1) * iterations / chunkCount; i++) {
+				region.next_iteration();
+				if(countedLoop->isRead) {
+					chunk_env->set_value(countedLoop->name, daedalus::entropia::values::get_number(start + i * step));
+				}
+				(void)daedalus::entropia::interpreter::evaluate_body(
+					interpreter,
+					parallelForExpression,
+					nullptr,
+					chunk_env
+				);
+			}
+		} catch(...) {
+			chunkErrors.at(chunk) = std::current_exception();
+		}
+	};
+
+	// A par for run by a worker (nested or in --batch) doesn't start more threads
+	if(
+		daedalus::entropia::pool::threadCount <= 1 ||
+		daedalus::entropia::pool::is_worker_thread() ||
+		iterations < daedalus::entropia::interpreter::PARALLEL_MIN_ITERATIONS
+	) {
+		for(size_t chunk = 0; chunk < chunkCount; chunk++) {
+			runChunk(chunk);
+		}
+	} else {
+		daedalus::entropia::pool::WorkStealingPool pool = daedalus::entropia::pool::WorkStealingPool(
+			daedalus::entropia::pool::threadCount,
+			chunkCount,
+			runChunk
+		);
+	}
+
+	// The error of the first iterations, as a serial loop would have stopped there
+	for(const std::exception_ptr& chunkError : chunkErrors) {
+		if(chunkError != nullptr) {
+			std::rethrow_exception(chunkError);
+		}
+	}
+
+	for(const daedalus::entropia::ast::Reduction& reduction : reductions) {
+		std::shared_ptr<daedalus::core::values::RuntimeValue> value = for_env->get_value(reduction.name);
+		for(std::shared_ptr<daedalus::core::env::Environment> chunk_env : chunkEnvs) {
+			value = combine_reduction(reduction.operator_symbol, value, chunk_env->get_value(reduction.name));
+		}
+		for_env->set_value(reduction.name, value);
+	}
+
+	// Value of the loop variable after the last update, like a counted loop
+	return daedalus::core::interpreter::wrap(daedalus::entropia::values::get_number(start + iterations * step));
+}
+
 daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter::evaluate_break_expression(
 	daedalus::core::interpreter::Interpreter& interpreter,
 	std::shared_ptr<daedalus::core::ast::Statement> statement,
 	std::shared_ptr<daedalus::core::env::Environment> env
 ) {
     return daedalus::core::interpreter::wrap(
-        std::make_shared<daedalus::core::values::NullValue>(),
+        daedalus::entropia::values::get_null(),
         static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK),
         true
     );
@@ -543,7 +1030,7 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	std::shared_ptr<daedalus::core::env::Environment> env
 ) {
     return daedalus::core::interpreter::wrap(
-        std::make_shared<daedalus::core::values::NullValue>(),
+        daedalus::entropia::values::get_null(),
         static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::CONTINUE),
         true
     );
@@ -562,14 +1049,11 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
             isTrue = daedalus::core::interpreter::evaluate_statement(interpreter, expression->get_condition(), env).value->IsTrue();
         }
         if(isTrue) {
-            auto results = std::vector<daedalus::core::interpreter::RuntimeResult>();
-            daedalus::core::interpreter::RuntimeValueWrapper last = daedalus::core::interpreter::evaluate_scope(
+            daedalus::core::interpreter::RuntimeValueWrapper last = daedalus::entropia::interpreter::evaluate_body(
                 interpreter,
                 expression,
-                results,
                 nullptr,
-                env,
-                static_cast<daedalus::core::interpreter::Flags>(daedalus::entropia::interpreter::ValueEscapeFlags::BREAK)
+                env
             );
             return last;
         }
@@ -578,6 +1062,24 @@ daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter
 	throw std::runtime_error("No condition matched (should not have been parsed");
 }
 
+daedalus::core::interpreter::RuntimeValueWrapper daedalus::entropia::interpreter::evaluate_lazy_scope(
+	daedalus::core::interpreter::Interpreter& interpreter,
+	std::shared_ptr<daedalus::core::ast::Statement> statement,
+	std::shared_ptr<daedalus::core::env::Environment> env
+) {
+    auto lazyScope = std::dynamic_pointer_cast<daedalus::entropia::ast::LazyScope>(statement);
+
+    daedalus::entropia::parser::parse_lazy_scope(lazyScope);
+
+    // The lazy scope stands for the body of its parent, so it shares its environment
+    return daedalus::entropia::interpreter::evaluate_body(
+        interpreter,
+        lazyScope,
+        env,
+        env
+    );
+}
+
 void setup_interpreter(daedalus::core::interpreter::Interpreter& interpreter) {
 
 	auto nodeEvaluationFunctions = std::unordered_map<std::string, daedalus::core::interpreter::ParseStatementFunction>({
@@ -625,6 +1127,10 @@ void setup_interpreter(daedalus::core::interpreter::Interpreter& interpreter) {
 		    "ForExpression",
 			&daedalus::entropia::interpreter::evaluate_for_expression
 		},
+		{
+		    "ParallelForExpression",
+			&daedalus::entropia::interpreter::evaluate_parallel_for_expression
+		},
 		{
 		    "BreakExpression",
 			&daedalus::entropia::interpreter::evaluate_break_expression
@@ -636,6 +1142,10 @@ void setup_interpreter(daedalus::core::interpreter::Interpreter& interpreter) {
 		{
 		    "ConditionnalStructure",
 			&daedalus::entropia::interpreter::evaluate_conditionnal_structure
+		},
+		{
+		    "LazyScope",
+			&daedalus::entropia::interpreter::evaluate_lazy_scope
 		}
 	});
 
@@ -650,16 +1160,9 @@ void setup_interpreter(daedalus::core::interpreter::Interpreter& interpreter) {
 		})
 	};
 
-	auto typeCastValidation = daedalus::core::env::EnvValidationRule{
-		&daedalus::entropia::env::validate_type_cast,
-		std::vector<daedalus::core::env::ValidationRuleSensitivity>({
-			daedalus::core::env::ValidationRuleSensitivity::SET
-		})
-	};
-
+	// The value types are checked before the execution by the TypeChecker
 	auto validationRules = std::vector<daedalus::core::env::EnvValidationRule>({
-		mutabilityValidation,
-		typeCastValidation
+		mutabilityValidation
 	});
 
 	auto flagsReturnStatementBefore = std::unordered_map<daedalus::core::interpreter::Flags, bool>({
@@ -0,0 +1,100 @@
+#include <daedalus/Entropia/interpreter/region.hpp>
+
+#include <cstdlib>
+#include <new>
+
+struct ChunkCache {
+	daedalus::entropia::region::Chunk* chunks[daedalus::entropia::region::CACHED_CHUNKS];
+	size_t count = 0;
+
+	~ChunkCache();
+};
+
+static thread_local ChunkCache chunkCache;
+// A value can outlive the cache of its thread (static / thread_local values)
+static thread_local bool isChunkCacheDestroyed = false;
+static thread_local daedalus::entropia::region::Region* currentRegion = nullptr;
+
+ChunkCache::~ChunkCache() {
+	for(size_t i = 0; i < this->count; i++) {
+		std::free(this->chunks[i]);
+	}
+	this->count = 0;
+	isChunkCacheDestroyed = true;
+}
+
+static daedalus::entropia::region::Chunk* new_chunk() {
+	void* memory = nullptr;
+	if(!isChunkCacheDestroyed && chunkCache.count > 0) {
+		memory = chunkCache.chunks[--chunkCache.count];
+	}
+	else {
+		memory = std::aligned_alloc(daedalus::entropia::region::CHUNK_SIZE, daedalus::entropia::region::CHUNK_SIZE);
+		if(memory == nullptr) {
+			throw std::bad_alloc();
+		}
+	}
+
+	auto chunk = static_cast<daedalus::entropia::region::Chunk*>(memory);
+	// The region reference
+	new (&chunk->references) std::atomic<size_t>(1);
+	chunk->offset = daedalus::entropia::region::CHUNK_HEADER_SIZE;
+	return chunk;
+}
+
+static void release_reference(daedalus::entropia::region::Chunk* chunk) {
+	if(chunk->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+		return;
+	}
+	if(!isChunkCacheDestroyed && chunkCache.count < daedalus::entropia::region::CACHED_CHUNKS) {
+		chunkCache.chunks[chunkCache.count++] = chunk;
+		return;
+	}
+	std::free(chunk);
+}
+
+daedalus::entropia::region::Region::Region() :
+	chunk(new_chunk()),
+	previous(currentRegion)
+{
+	currentRegion = this;
+}
+
+daedalus::entropia::region::Region::~Region() {
+	currentRegion = this->previous;
+	release_reference(this->chunk);
+}
+
+void* daedalus::entropia::region::Region::allocate(size_t size) {
+	size = daedalus::entropia::region::get_allocation_size(size);
+	if(this->chunk->offset + size > daedalus::entropia::region::CHUNK_SIZE) {
+		// Full, freed by its last value
+		release_reference(this->chunk);
+		this->chunk = new_chunk();
+	}
+
+	void* pointer = reinterpret_cast<char*>(this->chunk) + this->chunk->offset;
+	this->chunk->offset += size;
+	this->chunk->references.fetch_add(1, std::memory_order_relaxed);
+	return pointer;
+}
+
+void daedalus::entropia::region::Region::next_iteration() {
+	// Only allocated by this thread, nothing else can be bumped in meantime
+	if(this->chunk->references.load(std::memory_order_acquire) == 1) {
+		this->chunk->offset = daedalus::entropia::region::CHUNK_HEADER_SIZE;
+		return;
+	}
+	// A value escaped: the chunk is retired, freed by its last value, and the iteration starts on a fresh (cached) chunk
+	release_reference(this->chunk);
+	this->chunk = new_chunk();
+}
+
+daedalus::entropia::region::Region* daedalus::entropia::region::Region::get_current() {
+	return currentRegion;
+}
+
+void daedalus::entropia::region::deallocate(void* pointer) {
+	auto address = reinterpret_cast<std::uintptr_t>(pointer);
+	release_reference(reinterpret_cast<daedalus::entropia::region::Chunk*>(address & ~(daedalus::entropia::region::CHUNK_SIZE - 1)));
+}
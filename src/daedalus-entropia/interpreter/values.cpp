@@ -1,4 +1,12 @@
 #include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/interpreter/region.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 #pragma region BooleanValue
 
@@ -46,22 +54,109 @@ bool daedalus::entropia::values::CharValue::IsTrue() {
 
 #pragma region StrValue
 
+daedalus::entropia::values::SharedString daedalus::entropia::values::intern_string(const std::string& value) {
+	// Never released, the interned strings are the literals of the programs
+	static std::mutex internedStringsMutex;
+	static std::unordered_map<std::string_view, daedalus::entropia::values::SharedString> internedStrings;
+
+	std::lock_guard<std::mutex> lock(internedStringsMutex);
+	auto internedString = internedStrings.find(std::string_view(value));
+	if(internedString != internedStrings.end()) {
+		return internedString->second;
+	}
+	auto sharedString = std::make_shared<const std::string>(value);
+	internedStrings.emplace(std::string_view(*sharedString), sharedString);
+	return sharedString;
+}
+
 daedalus::entropia::values::StrValue::StrValue(std::string value) :
-	value(value)
+	value(std::make_shared<const std::string>(std::move(value))),
+	isInterned(false)
 {}
 
-std::string daedalus::entropia::values::StrValue::get() {
-	return this->value;
+daedalus::entropia::values::StrValue::StrValue(daedalus::entropia::values::SharedString value, bool isInterned) :
+	value(value),
+	isInterned(isInterned)
+{}
+
+const std::string& daedalus::entropia::values::StrValue::get() {
+	return *this->value;
+}
+
+bool daedalus::entropia::values::StrValue::is_interned() {
+	return this->isInterned;
+}
+
+bool daedalus::entropia::values::StrValue::equals(daedalus::entropia::values::StrValue& other) {
+	if(this->value == other.value) {
+		return true;
+	}
+	if(this->isInterned && other.isInterned) {
+		return false;
+	}
+	// memcmp is vectorized by the C library
+	return
+		this->value->size() == other.value->size() &&
+		std::memcmp(this->value->data(), other.value->data(), this->value->size()) == 0;
 }
 
 std::string daedalus::entropia::values::StrValue::type() {
 	return "StrValue";
 }
 std::string daedalus::entropia::values::StrValue::repr() {
-	return "\"" + this->value + "\"";
+	return "\"" + *this->value + "\"";
 }
 bool daedalus::entropia::values::StrValue::IsTrue() {
-	return !this->value.empty();
+	return !this->value->empty();
+}
+
+#pragma endregion
+
+#pragma region Cached values
+
+// Function statics, initialized once even with several threads
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::values::get_boolean(bool value) {
+	static const std::shared_ptr<daedalus::core::values::RuntimeValue> trueValue = std::make_shared<daedalus::entropia::values::BooleanValue>(true);
+	static const std::shared_ptr<daedalus::core::values::RuntimeValue> falseValue = std::make_shared<daedalus::entropia::values::BooleanValue>(false);
+	return value ? trueValue : falseValue;
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::values::get_null() {
+	static const std::shared_ptr<daedalus::core::values::RuntimeValue> nullValue = std::make_shared<daedalus::core::values::NullValue>();
+	return nullValue;
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::values::get_char(char value) {
+	static const std::array<std::shared_ptr<daedalus::core::values::RuntimeValue>, 256> charValues = []() {
+		auto values = std::array<std::shared_ptr<daedalus::core::values::RuntimeValue>, 256>();
+		for(int i = 0; i < 256; i++) {
+			values.at(i) = std::make_shared<daedalus::entropia::values::CharValue>(static_cast<char>(i));
+		}
+		return values;
+	}();
+	return charValues.at(static_cast<unsigned char>(value));
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::values::get_number(double value) {
+	static const size_t SMALL_INTEGER_COUNT = daedalus::entropia::values::SMALL_INTEGER_MAX - daedalus::entropia::values::SMALL_INTEGER_MIN + 1;
+	static const std::array<std::shared_ptr<daedalus::core::values::RuntimeValue>, SMALL_INTEGER_COUNT> numberValues = []() {
+		auto values = std::array<std::shared_ptr<daedalus::core::values::RuntimeValue>, SMALL_INTEGER_COUNT>();
+		for(size_t i = 0; i < SMALL_INTEGER_COUNT; i++) {
+			values.at(i) = std::make_shared<daedalus::core::values::NumberValue>(static_cast<double>(daedalus::entropia::values::SMALL_INTEGER_MIN + static_cast<int>(i)));
+		}
+		return values;
+	}();
+
+	// -0 keeps its own value, its sign is visible once divided
+	if(
+		value >= daedalus::entropia::values::SMALL_INTEGER_MIN &&
+		value <= daedalus::entropia::values::SMALL_INTEGER_MAX &&
+		value == std::floor(value) &&
+		!(value == 0 && std::signbit(value))
+	) {
+		return numberValues[static_cast<size_t>(static_cast<int>(value) - daedalus::entropia::values::SMALL_INTEGER_MIN)];
+	}
+	return daedalus::entropia::region::make_value<daedalus::core::values::NumberValue>(value);
 }
 
 #pragma endregion
@@ -0,0 +1,645 @@
+#include <daedalus/Entropia/jit/jit.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <sys/mman.h>
+#define ENTROPIA_JIT_SUPPORTED
+#endif
+
+bool daedalus::entropia::jit::jitLoops = false;
+
+static const size_t RESULT_SLOT = 0;
+static const size_t RESULT_KIND_SLOT = 1;
+static const size_t RAN_SLOT = 2;
+static const size_t FIRST_SLOT = 3;
+
+static const size_t MIN_SWEEP_SIZE = 256;
+
+static const size_t UNBOUND_LABEL = std::numeric_limits<size_t>::max();
+
+// SSE2 opcodes (0F xx)
+static const uint8_t ADDSD = 0x58;
+static const uint8_t MULSD = 0x59;
+static const uint8_t SUBSD = 0x5C;
+static const uint8_t DIVSD = 0x5E;
+static const uint8_t ANDPD = 0x54;
+static const uint8_t ORPD = 0x56;
+
+// cmpsd predicates
+static const uint8_t CMP_EQ = 0;
+static const uint8_t CMP_LT = 1;
+static const uint8_t CMP_LE = 2;
+static const uint8_t CMP_NEQ = 4;
+
+#pragma region Assembler
+
+daedalus::entropia::jit::Assembler::Assembler() :
+	code(),
+	labels(),
+	fixups()
+{}
+
+std::vector<uint8_t> daedalus::entropia::jit::Assembler::finish() {
+	for(const auto& [position, label] : this->fixups) {
+		DAE_ASSERT_TRUE(
+			this->labels.at(label) != UNBOUND_LABEL,
+			std::runtime_error("Unbound label in native loop")
+		)
+		int32_t offset = static_cast<int32_t>(this->labels.at(label)) - static_cast<int32_t>(position + 4);
+		std::memcpy(this->code.data() + position, &offset, sizeof(offset));
+	}
+	return this->code;
+}
+
+size_t daedalus::entropia::jit::Assembler::new_label() {
+	this->labels.push_back(UNBOUND_LABEL);
+	return this->labels.size() - 1;
+}
+
+void daedalus::entropia::jit::Assembler::bind(size_t label) {
+	this->labels.at(label) = this->code.size();
+}
+
+void daedalus::entropia::jit::Assembler::emit(std::vector<uint8_t> bytes) {
+	this->code.insert(this->code.end(), bytes.begin(), bytes.end());
+}
+
+void daedalus::entropia::jit::Assembler::emit_slot(uint8_t opcode_prefix, uint8_t opcode, int xmm, size_t slot) {
+	// [rdi + disp32]
+	uint32_t displacement = static_cast<uint32_t>(slot * sizeof(double));
+	this->emit({ opcode_prefix, 0x0F, opcode, static_cast<uint8_t>(0x87 | (xmm << 3)) });
+	for(int i = 0; i < 4; i++) {
+		this->code.push_back(static_cast<uint8_t>(displacement >> (8 * i)));
+	}
+}
+
+void daedalus::entropia::jit::Assembler::emit_label(size_t label) {
+	this->fixups.push_back({ this->code.size(), label });
+	this->emit({ 0, 0, 0, 0 });
+}
+
+void daedalus::entropia::jit::Assembler::load(int xmm, size_t slot) {
+	// movsd xmm, [rdi + slot]
+	this->emit_slot(0xF2, 0x10, xmm, slot);
+}
+
+void daedalus::entropia::jit::Assembler::store(size_t slot, int xmm) {
+	// movsd [rdi + slot], xmm
+	this->emit_slot(0xF2, 0x11, xmm, slot);
+}
+
+void daedalus::entropia::jit::Assembler::load_constant(int xmm, double value) {
+	uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	// mov rax, imm64 / movq xmm, rax
+	this->emit({ 0x48, 0xB8 });
+	for(int i = 0; i < 8; i++) {
+		this->code.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+	}
+	this->emit({ 0x66, 0x48, 0x0F, 0x6E, static_cast<uint8_t>(0xC0 | (xmm << 3)) });
+}
+
+void daedalus::entropia::jit::Assembler::store_constant(size_t slot, double value) {
+	uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	// mov rax, imm64 / mov [rdi + slot], rax
+	this->emit({ 0x48, 0xB8 });
+	for(int i = 0; i < 8; i++) {
+		this->code.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+	}
+	uint32_t displacement = static_cast<uint32_t>(slot * sizeof(double));
+	this->emit({ 0x48, 0x89, 0x87 });
+	for(int i = 0; i < 4; i++) {
+		this->code.push_back(static_cast<uint8_t>(displacement >> (8 * i)));
+	}
+}
+
+void daedalus::entropia::jit::Assembler::move(int destination, int source) {
+	// movapd destination, source
+	this->emit({ 0x66, 0x0F, 0x28, static_cast<uint8_t>(0xC0 | (destination << 3) | source) });
+}
+
+void daedalus::entropia::jit::Assembler::arithmetic(uint8_t opcode) {
+	this->emit({ 0xF2, 0x0F, opcode, 0xC1 });
+}
+
+void daedalus::entropia::jit::Assembler::compare(int left, int right, uint8_t predicate) {
+	// cmpsd left, right, predicate / movq rax, left / and eax, 1
+	this->emit({ 0xF2, 0x0F, 0xC2, static_cast<uint8_t>(0xC0 | (left << 3) | right), predicate });
+	this->emit({ 0x66, 0x48, 0x0F, 0x7E, static_cast<uint8_t>(0xC0 | (left << 3)) });
+	this->emit({ 0x83, 0xE0, 0x01 });
+}
+
+void daedalus::entropia::jit::Assembler::truthiness() {
+	// xorpd xmm1, xmm1, NaN is true as in NumberValue::IsTrue
+	this->emit({ 0x66, 0x0F, 0x57, 0xC9 });
+	this->compare(0, 1, CMP_NEQ);
+}
+
+void daedalus::entropia::jit::Assembler::boolean_to_number() {
+	// cvtsi2sd xmm0, eax
+	this->emit({ 0xF2, 0x0F, 0x2A, 0xC0 });
+}
+
+void daedalus::entropia::jit::Assembler::negate_boolean() {
+	// xor eax, 1
+	this->emit({ 0x83, 0xF0, 0x01 });
+}
+
+void daedalus::entropia::jit::Assembler::bitwise(uint8_t opcode) {
+	this->emit({ 0x66, 0x0F, opcode, 0xC1 });
+}
+
+void daedalus::entropia::jit::Assembler::jump(size_t label) {
+	this->emit({ 0xE9 });
+	this->emit_label(label);
+}
+
+void daedalus::entropia::jit::Assembler::jump_if_false(size_t label) {
+	// test eax, eax / jz label
+	this->emit({ 0x85, 0xC0, 0x0F, 0x84 });
+	this->emit_label(label);
+}
+
+void daedalus::entropia::jit::Assembler::jump_if_zero_divisor(size_t label) {
+	// xorpd xmm2, xmm2 / ucomisd xmm1, xmm2 / jp +6 / je label
+	this->emit({ 0x66, 0x0F, 0x57, 0xD2, 0x66, 0x0F, 0x2E, 0xCA, 0x7A, 0x06, 0x0F, 0x84 });
+	this->emit_label(label);
+}
+
+void daedalus::entropia::jit::Assembler::exit(daedalus::entropia::jit::ExitStatus status) {
+	// mov eax, status / ret
+	uint32_t value = static_cast<uint32_t>(status);
+	this->emit({ 0xB8 });
+	for(int i = 0; i < 4; i++) {
+		this->code.push_back(static_cast<uint8_t>(value >> (8 * i)));
+	}
+	this->emit({ 0xC3 });
+}
+
+#pragma endregion
+
+#pragma region NativeLoop
+
+daedalus::entropia::jit::NativeLoop::NativeLoop(std::vector<uint8_t> code, std::vector<daedalus::entropia::jit::FreeVariable> freeVariables, size_t frameSize) :
+	freeVariables(freeVariables),
+	frameSize(frameSize),
+	memory(nullptr),
+	size(code.size())
+{
+#ifdef ENTROPIA_JIT_SUPPORTED
+	void* memory = mmap(nullptr, this->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	DAE_ASSERT_TRUE(
+		memory != MAP_FAILED,
+		std::runtime_error("Failed to map the native loop")
+	)
+	std::memcpy(memory, code.data(), code.size());
+
+	// Never writable and executable at once
+	if(mprotect(memory, this->size, PROT_READ | PROT_EXEC) != 0) {
+		munmap(memory, this->size);
+		throw std::runtime_error("Failed to make the native loop executable");
+	}
+	this->memory = memory;
+#else
+	throw std::runtime_error("The JIT is only supported on x86-64 POSIX systems");
+#endif
+}
+
+daedalus::entropia::jit::NativeLoop::~NativeLoop() {
+#ifdef ENTROPIA_JIT_SUPPORTED
+	if(this->memory != nullptr) {
+		munmap(this->memory, this->size);
+	}
+#endif
+}
+
+daedalus::entropia::jit::ExitStatus daedalus::entropia::jit::NativeLoop::run(double* frame) {
+	auto function = reinterpret_cast<uint64_t (*)(double*)>(this->memory);
+	return static_cast<daedalus::entropia::jit::ExitStatus>(function(frame));
+}
+
+#pragma endregion
+
+#pragma region LoopCompiler
+
+daedalus::entropia::jit::LoopCompiler::LoopCompiler() :
+	assembler(),
+	scopes(),
+	freeVariables(),
+	temporaries(),
+	slotCount(FIRST_SLOT),
+	loopStart(0),
+	loopEnd(0),
+	divideByZero(0),
+	noConditionMatched(0)
+{}
+
+daedalus::entropia::jit::SlotKind daedalus::entropia::jit::LoopCompiler::get_kind(std::string type) {
+	if(daedalus::entropia::checker::is_number_type(type)) {
+		return daedalus::entropia::jit::SlotKind::NUMBER;
+	}
+	if(type == "bool") {
+		return daedalus::entropia::jit::SlotKind::BOOLEAN;
+	}
+	throw std::runtime_error("Unsupported type \"" + type + "\"");
+}
+
+size_t daedalus::entropia::jit::LoopCompiler::get_variable(std::string name, daedalus::entropia::jit::SlotKind kind, bool isAssigned) {
+	for(auto scope = this->scopes.rbegin(); scope != this->scopes.rend(); scope++) {
+		auto local = scope->find(name);
+		if(local != scope->end()) {
+			// The interpreter reports the error
+			DAE_ASSERT_TRUE(
+				!isAssigned || local->second.isMutable,
+				std::runtime_error("Assignment to immutable value \"" + name + "\"")
+			)
+			DAE_ASSERT_TRUE(
+				local->second.kind == kind,
+				std::runtime_error("Mismatched kind for \"" + name + "\"")
+			)
+			return local->second.slot;
+		}
+	}
+
+	for(daedalus::entropia::jit::FreeVariable& freeVariable : this->freeVariables) {
+		if(freeVariable.name == name) {
+			DAE_ASSERT_TRUE(
+				freeVariable.kind == kind,
+				std::runtime_error("Mismatched kind for \"" + name + "\"")
+			)
+			freeVariable.isAssigned = freeVariable.isAssigned || isAssigned;
+			return freeVariable.slot;
+		}
+	}
+
+	this->freeVariables.push_back(daedalus::entropia::jit::FreeVariable{ name, this->slotCount, kind, isAssigned });
+	return this->slotCount++;
+}
+
+size_t daedalus::entropia::jit::LoopCompiler::get_temporary(size_t depth) {
+	while(this->temporaries.size() <= depth) {
+		this->temporaries.push_back(this->slotCount++);
+	}
+	return this->temporaries.at(depth);
+}
+
+daedalus::entropia::jit::SlotKind daedalus::entropia::jit::LoopCompiler::emit_operand(std::shared_ptr<daedalus::core::ast::Expression> expression, int xmm) {
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		this->assembler.load_constant(xmm, std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)->get_value());
+		return daedalus::entropia::jit::SlotKind::NUMBER;
+	}
+	if(type == "BooleanExpression") {
+		this->assembler.load_constant(xmm, std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)->get_value() ? 1 : 0);
+		return daedalus::entropia::jit::SlotKind::BOOLEAN;
+	}
+	if(type == "Identifier") {
+		auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression);
+		daedalus::entropia::jit::SlotKind kind = this->get_kind(identifier->get_static_type());
+		this->assembler.load(xmm, this->get_variable(identifier->get_name(), kind, false));
+		return kind;
+	}
+	return daedalus::entropia::jit::SlotKind::NONE;
+}
+
+daedalus::entropia::jit::SlotKind daedalus::entropia::jit::LoopCompiler::emit_expression(std::shared_ptr<daedalus::core::ast::Expression> expression, size_t depth) {
+	daedalus::entropia::jit::SlotKind operandKind = this->emit_operand(expression, 0);
+	if(operandKind != daedalus::entropia::jit::SlotKind::NONE) {
+		return operandKind;
+	}
+
+	if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		DAE_ASSERT_TRUE(
+			unaryExpression->get_operator_symbol() == "!",
+			std::runtime_error("Unsupported unary operator " + unaryExpression->get_operator_symbol())
+		)
+		this->emit_expression(unaryExpression->get_term(), depth);
+		this->assembler.truthiness();
+		this->assembler.negate_boolean();
+		this->assembler.boolean_to_number();
+		return daedalus::entropia::jit::SlotKind::BOOLEAN;
+	}
+
+	auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+	DAE_ASSERT_TRUE(
+		binaryExpression != nullptr,
+		std::runtime_error("Unsupported node " + expression->type())
+	)
+	std::string operator_symbol = binaryExpression->get_operator_symbol();
+
+	// Both operands are evaluated, as in the interpreter
+	if(operator_symbol == "&&" || operator_symbol == "||") {
+		size_t temporary = this->get_temporary(depth);
+		this->emit_expression(binaryExpression->get_left(), depth);
+		this->assembler.truthiness();
+		this->assembler.boolean_to_number();
+		this->assembler.store(temporary, 0);
+		this->emit_expression(binaryExpression->get_right(), depth + 1);
+		this->assembler.truthiness();
+		this->assembler.boolean_to_number();
+		this->assembler.move(1, 0);
+		this->assembler.load(0, temporary);
+		this->assembler.bitwise(operator_symbol == "&&" ? ANDPD : ORPD);
+		return daedalus::entropia::jit::SlotKind::BOOLEAN;
+	}
+
+	// left in xmm0, right in xmm1
+	daedalus::entropia::jit::SlotKind leftKind = this->emit_expression(binaryExpression->get_left(), depth);
+	daedalus::entropia::jit::SlotKind rightKind = this->emit_operand(binaryExpression->get_right(), 1);
+	if(rightKind == daedalus::entropia::jit::SlotKind::NONE) {
+		size_t temporary = this->get_temporary(depth);
+		this->assembler.store(temporary, 0);
+		rightKind = this->emit_expression(binaryExpression->get_right(), depth + 1);
+		this->assembler.move(1, 0);
+		this->assembler.load(0, temporary);
+	}
+
+	if(operator_symbol == "==" || operator_symbol == "!=") {
+		DAE_ASSERT_TRUE(
+			leftKind == rightKind,
+			std::runtime_error("Unsupported operands for " + operator_symbol)
+		)
+		this->assembler.compare(0, 1, operator_symbol == "==" ? CMP_EQ : CMP_NEQ);
+		this->assembler.boolean_to_number();
+		return daedalus::entropia::jit::SlotKind::BOOLEAN;
+	}
+
+	DAE_ASSERT_TRUE(
+		leftKind == daedalus::entropia::jit::SlotKind::NUMBER && rightKind == daedalus::entropia::jit::SlotKind::NUMBER,
+		std::runtime_error("Unsupported operands for " + operator_symbol)
+	)
+
+	if(operator_symbol == "+" || operator_symbol == "-" || operator_symbol == "*") {
+		this->assembler.arithmetic(operator_symbol == "+" ? ADDSD : operator_symbol == "-" ? SUBSD : MULSD);
+		return daedalus::entropia::jit::SlotKind::NUMBER;
+	}
+	if(operator_symbol == "/") {
+		this->assembler.jump_if_zero_divisor(this->divideByZero);
+		this->assembler.arithmetic(DIVSD);
+		return daedalus::entropia::jit::SlotKind::NUMBER;
+	}
+	// a > b is b < a
+	if(operator_symbol == "<" || operator_symbol == "<=") {
+		this->assembler.compare(0, 1, operator_symbol == "<" ? CMP_LT : CMP_LE);
+	} else if(operator_symbol == ">" || operator_symbol == ">=") {
+		this->assembler.compare(1, 0, operator_symbol == ">" ? CMP_LT : CMP_LE);
+	} else {
+		throw std::runtime_error("Unsupported operator " + operator_symbol);
+	}
+	this->assembler.boolean_to_number();
+	return daedalus::entropia::jit::SlotKind::BOOLEAN;
+}
+
+void daedalus::entropia::jit::LoopCompiler::emit_condition(std::shared_ptr<daedalus::core::ast::Expression> expression, size_t label) {
+	this->emit_expression(expression, 0);
+	this->assembler.truthiness();
+	this->assembler.jump_if_false(label);
+}
+
+void daedalus::entropia::jit::LoopCompiler::emit_result(daedalus::entropia::jit::SlotKind kind) {
+	this->assembler.store(RESULT_SLOT, 0);
+	this->assembler.store_constant(RESULT_KIND_SLOT, static_cast<double>(static_cast<int>(kind)));
+}
+
+void daedalus::entropia::jit::LoopCompiler::emit_statement(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	std::string type = expression->type();
+
+	// The value of a break / continue is the one of the statement before (or null), already in the result
+	if(type == "BreakExpression") {
+		this->assembler.jump(this->loopEnd);
+		return;
+	}
+	if(type == "ContinueExpression") {
+		this->assembler.jump(this->loopStart);
+		return;
+	}
+	if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		std::string name = declarationExpression->get_identifier()->get_name();
+		daedalus::entropia::jit::SlotKind kind = this->get_kind(declarationExpression->get_value_type());
+
+		// The value is computed before the name is visible
+		DAE_ASSERT_TRUE(
+			this->emit_expression(declarationExpression->get_value(), 0) == kind,
+			std::runtime_error("Mismatched kind for \"" + name + "\"")
+		)
+		DAE_ASSERT_TRUE(
+			this->scopes.back().find(name) == this->scopes.back().end(),
+			std::runtime_error("Redeclaration of \"" + name + "\"")
+		)
+		size_t slot = this->slotCount++;
+		this->scopes.back()[name] = daedalus::entropia::jit::LocalVariable{ slot, kind, declarationExpression->get_mutability() };
+		this->assembler.store(slot, 0);
+		this->emit_result(kind);
+		return;
+	}
+	if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		daedalus::entropia::jit::SlotKind kind = this->emit_expression(assignationExpression->get_value(), 0);
+		this->assembler.store(this->get_variable(assignationExpression->get_identifier()->get_name(), kind, true), 0);
+		this->emit_result(kind);
+		return;
+	}
+	if(type == "ConditionnalStructure") {
+		size_t end = this->assembler.new_label();
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)->get_expressions()) {
+			size_t next = this->assembler.new_label();
+			if(conditionnalExpression->get_condition() != nullptr) {
+				this->emit_condition(conditionnalExpression->get_condition(), next);
+			}
+			this->emit_body(conditionnalExpression->get_body());
+			this->assembler.jump(end);
+			this->assembler.bind(next);
+		}
+		this->assembler.jump(this->noConditionMatched);
+		this->assembler.bind(end);
+		return;
+	}
+	if(type == "LazyScope") {
+		auto lazyScope = std::dynamic_pointer_cast<daedalus::entropia::ast::LazyScope>(expression);
+		DAE_ASSERT_TRUE(
+			lazyScope->is_parsed() && !lazyScope->get_body().empty(),
+			std::runtime_error("Unparsed lazy scope")
+		)
+		// The lazy scope shares the environment of its parent
+		for(std::shared_ptr<daedalus::core::ast::Expression> statement : lazyScope->get_body()) {
+			this->emit_statement(statement);
+		}
+		return;
+	}
+
+	this->emit_result(this->emit_expression(expression, 0));
+}
+
+void daedalus::entropia::jit::LoopCompiler::emit_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+	// An empty scope has no value, the interpreter handles it
+	DAE_ASSERT_TRUE(
+		!body.empty(),
+		std::runtime_error("Empty scope")
+	)
+	this->scopes.push_back(std::unordered_map<std::string, daedalus::entropia::jit::LocalVariable>());
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		this->emit_statement(expression);
+	}
+	this->scopes.pop_back();
+}
+
+std::unique_ptr<daedalus::entropia::jit::NativeLoop> daedalus::entropia::jit::LoopCompiler::compile(std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression) {
+	this->loopStart = this->assembler.new_label();
+	this->loopEnd = this->assembler.new_label();
+	this->divideByZero = this->assembler.new_label();
+	this->noConditionMatched = this->assembler.new_label();
+
+	this->assembler.bind(this->loopStart);
+	if(auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(loopExpression)) {
+		this->emit_condition(whileExpression->get_condition(), this->loopEnd);
+	}
+	this->assembler.store_constant(RAN_SLOT, 1);
+	this->assembler.store_constant(RESULT_KIND_SLOT, static_cast<double>(static_cast<int>(daedalus::entropia::jit::SlotKind::NONE)));
+	// The update expression runs as the last statement of the body, skipped by continue as in the interpreter
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body = loopExpression->get_body();
+	if(auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(loopExpression)) {
+		body.push_back(forExpression->get_update_expression());
+	}
+	this->emit_body(body);
+	this->assembler.jump(this->loopStart);
+
+	this->assembler.bind(this->loopEnd);
+	this->assembler.exit(daedalus::entropia::jit::ExitStatus::DONE);
+	this->assembler.bind(this->divideByZero);
+	this->assembler.exit(daedalus::entropia::jit::ExitStatus::DIVIDE_BY_ZERO);
+	this->assembler.bind(this->noConditionMatched);
+	this->assembler.exit(daedalus::entropia::jit::ExitStatus::NO_CONDITION_MATCHED);
+
+	return std::make_unique<daedalus::entropia::jit::NativeLoop>(this->assembler.finish(), this->freeVariables, this->slotCount);
+}
+
+#pragma endregion
+
+struct HotLoop {
+	// Expired once the program of the loop is freed, its address can then be the one of another loop
+	std::weak_ptr<daedalus::entropia::ast::LoopExpression> loop;
+	uint64_t iterations;
+	bool isFailed;
+	std::unique_ptr<daedalus::entropia::jit::NativeLoop> native;
+};
+
+struct HotLoops {
+	std::unordered_map<const daedalus::entropia::ast::LoopExpression*, HotLoop> loops;
+	// Past this size, the loops of the freed programs are dropped
+	size_t sweepSize;
+};
+
+// Counted and compiled by each thread, the programs are shared read-only
+// A worker outlives the programs it runs (--batch, --serve), so the loops are checked against their programs
+static thread_local HotLoops hotLoops = HotLoops{ {}, MIN_SWEEP_SIZE };
+
+static HotLoop& get_hot_loop(std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression) {
+	auto entry = hotLoops.loops.find(loopExpression.get());
+	if(entry != hotLoops.loops.end()) {
+		if(entry->second.loop.expired()) {
+			// Another loop allocated where a freed one was
+			entry->second = HotLoop{ loopExpression, 0, false, nullptr };
+		}
+		return entry->second;
+	}
+
+	if(hotLoops.loops.size() >= hotLoops.sweepSize) {
+		for(auto loop = hotLoops.loops.begin(); loop != hotLoops.loops.end();) {
+			loop = loop->second.loop.expired() ? hotLoops.loops.erase(loop) : std::next(loop);
+		}
+		hotLoops.sweepSize = std::max(MIN_SWEEP_SIZE, 2 * hotLoops.loops.size());
+	}
+	return hotLoops.loops.emplace(loopExpression.get(), HotLoop{ loopExpression, 0, false, nullptr }).first->second;
+}
+
+static std::shared_ptr<daedalus::core::values::RuntimeValue> make_value(double value, daedalus::entropia::jit::SlotKind kind) {
+	if(kind == daedalus::entropia::jit::SlotKind::NUMBER) {
+		return daedalus::entropia::values::get_number(value);
+	}
+	if(kind == daedalus::entropia::jit::SlotKind::BOOLEAN) {
+		return daedalus::entropia::values::get_boolean(value != 0);
+	}
+	return daedalus::entropia::values::get_null();
+}
+
+bool daedalus::entropia::jit::run_hot_loop(
+	std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression,
+	std::shared_ptr<daedalus::core::env::Environment> env,
+	daedalus::core::interpreter::RuntimeValueWrapper& scope_result
+) {
+	if(!daedalus::entropia::jit::jitLoops) {
+		return false;
+	}
+
+	HotLoop& hotLoop = get_hot_loop(loopExpression);
+	if(hotLoop.isFailed || ++hotLoop.iterations <= daedalus::entropia::jit::HOT_LOOP_THRESHOLD) {
+		return false;
+	}
+
+	if(hotLoop.native == nullptr) {
+		try {
+			hotLoop.native = daedalus::entropia::jit::LoopCompiler().compile(loopExpression);
+			DAE_DEBUG_LOG("JIT COMPILED LOOP " + loopExpression->repr())
+		} catch(const std::exception& error) {
+			DAE_DEBUG_LOG(std::string("JIT ") + error.what())
+			hotLoop.isFailed = true;
+			return false;
+		}
+	}
+
+	daedalus::entropia::jit::NativeLoop& native = *hotLoop.native;
+	std::vector<double> frame = std::vector<double>(native.frameSize, 0);
+
+	// Guards, the loop stays interpreted if the environment doesn't match
+	try {
+		for(const daedalus::entropia::jit::FreeVariable& freeVariable : native.freeVariables) {
+			std::shared_ptr<daedalus::core::values::RuntimeValue> value = env->get_value(freeVariable.name);
+			if(freeVariable.kind == daedalus::entropia::jit::SlotKind::NUMBER && value->type() == "NumberValue") {
+				frame.at(freeVariable.slot) = std::dynamic_pointer_cast<daedalus::core::values::NumberValue>(value)->get();
+			} else if(freeVariable.kind == daedalus::entropia::jit::SlotKind::BOOLEAN && value->type() == "BooleanValue") {
+				frame.at(freeVariable.slot) = std::dynamic_pointer_cast<daedalus::entropia::values::BooleanValue>(value)->get() ? 1 : 0;
+			} else {
+				throw std::runtime_error("Unexpected value for \"" + freeVariable.name + "\"");
+			}
+			// Checks the mutability without changing the value
+			if(freeVariable.isAssigned) {
+				env->set_value(freeVariable.name, value);
+			}
+		}
+	} catch(const std::exception& error) {
+		DAE_DEBUG_LOG(std::string("JIT ") + error.what())
+		hotLoop.isFailed = true;
+		return false;
+	}
+
+	daedalus::entropia::jit::ExitStatus status = native.run(frame.data());
+
+	for(const daedalus::entropia::jit::FreeVariable& freeVariable : native.freeVariables) {
+		if(freeVariable.isAssigned) {
+			env->set_value(freeVariable.name, make_value(frame.at(freeVariable.slot), freeVariable.kind));
+		}
+	}
+
+	if(status == daedalus::entropia::jit::ExitStatus::DIVIDE_BY_ZERO) {
+		throw std::runtime_error("Trying to divide by zero");
+	}
+	if(status == daedalus::entropia::jit::ExitStatus::NO_CONDITION_MATCHED) {
+		throw std::runtime_error("No condition matched (should not have been parsed");
+	}
+
+	if(frame.at(RAN_SLOT) != 0) {
+		scope_result = daedalus::core::interpreter::wrap(
+			make_value(frame.at(RESULT_SLOT), static_cast<daedalus::entropia::jit::SlotKind>(static_cast<int>(frame.at(RESULT_KIND_SLOT))))
+		);
+	}
+	return true;
+}
@@ -36,6 +36,7 @@ void setup_lexer(daedalus::core::lexer::Lexer& lexer) {
 		daedalus::core::lexer::make_token_type("SEMICOLON", ";"),
 
 		daedalus::core::lexer::make_token_type("COLON", ":"),
+		daedalus::core::lexer::make_token_type("COMMA", ","),
 
 		daedalus::core::lexer::make_token_type("OPEN_PAREN", "("),
 		daedalus::core::lexer::make_token_type("CLOSE_PAREN", ")"),
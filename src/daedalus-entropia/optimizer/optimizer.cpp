@@ -0,0 +1,736 @@
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <unordered_set>
+
+struct CommonSubexpression {
+	std::shared_ptr<daedalus::core::ast::Expression> expression;
+	std::unordered_set<std::string> inputs;
+	// Indices of the statements using the expression, the first one computes it
+	std::vector<size_t> statements;
+	size_t uses;
+};
+
+static std::string get_pointer_key(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	return std::to_string(reinterpret_cast<std::uintptr_t>(expression.get()));
+}
+
+static bool is_operation(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	return expression->type() == "UnaryExpression" || expression->type() == "BinaryExpression";
+}
+
+static size_t get_operation_count(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		return 1 + get_operation_count(unaryExpression->get_term());
+	}
+	if(auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression)) {
+		return 1 + get_operation_count(binaryExpression->get_left()) + get_operation_count(binaryExpression->get_right());
+	}
+	return 0;
+}
+
+static void collect_identifiers(std::shared_ptr<daedalus::core::ast::Expression> expression, std::unordered_set<std::string>& identifiers) {
+	if(auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression)) {
+		identifiers.insert(identifier->get_name());
+	}
+	else if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		collect_identifiers(unaryExpression->get_term(), identifiers);
+	}
+	else if(auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression)) {
+		collect_identifiers(binaryExpression->get_left(), identifiers);
+		collect_identifiers(binaryExpression->get_right(), identifiers);
+	}
+}
+
+static void collect_writes(std::shared_ptr<daedalus::core::ast::Expression> expression, std::unordered_set<std::string>& writes, bool& writesAll) {
+	if(expression == nullptr) {
+		return;
+	}
+	// The declarations too (a DeclarationExpression is an AssignationExpression), a name declared in a loop is another value at each iteration
+	if(auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression)) {
+		writes.insert(assignationExpression->get_identifier()->get_name());
+	}
+	if(expression->type() == "LazyScope") {
+		// Not parsed yet, any value can be assigned in it
+		writesAll = true;
+		return;
+	}
+	(void)daedalus::entropia::optimizer::map_children(
+		expression,
+		[&writes, &writesAll](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			collect_writes(child, writes, writesAll);
+			return child;
+		},
+		[&writes, &writesAll](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			for(std::shared_ptr<daedalus::core::ast::Expression> child : body) {
+				collect_writes(child, writes, writesAll);
+			}
+			return body;
+		}
+	);
+}
+
+static bool contains_node(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	const std::function<bool(std::shared_ptr<daedalus::core::ast::Expression>)>& predicate
+) {
+	if(expression == nullptr) {
+		return false;
+	}
+	if(predicate(expression)) {
+		return true;
+	}
+	bool isFound = false;
+	(void)daedalus::entropia::optimizer::map_children(
+		expression,
+		[&isFound, &predicate](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			isFound = isFound || contains_node(child, predicate);
+			return child;
+		},
+		[&isFound, &predicate](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			for(std::shared_ptr<daedalus::core::ast::Expression> child : body) {
+				isFound = isFound || contains_node(child, predicate);
+			}
+			return body;
+		}
+	);
+	return isFound;
+}
+
+/**
+ * Expressions of the statement always evaluated before its assignations: the operations, the assigned values and the first condition
+ */
+static std::vector<std::shared_ptr<daedalus::core::ast::Expression>> get_straight_line_expressions(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(is_operation(expression)) {
+		return { expression };
+	}
+	if(auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression)) {
+		return get_straight_line_expressions(assignationExpression->get_value());
+	}
+	if(auto conditionnalStructure = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)) {
+		// Only the first condition always runs, an else if one is skipped when a branch before it is taken
+		std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>> conditionnalExpressions = conditionnalStructure->get_expressions();
+		if(conditionnalExpressions.empty() || conditionnalExpressions.front()->get_condition() == nullptr) {
+			return {};
+		}
+		return get_straight_line_expressions(conditionnalExpressions.front()->get_condition());
+	}
+	return {};
+}
+
+/**
+ * Replace the target in the straight-line expressions of the statement
+ */
+static std::shared_ptr<daedalus::core::ast::Expression> substitute_expression(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	std::shared_ptr<daedalus::core::ast::Expression> target,
+	std::shared_ptr<daedalus::core::ast::Expression> replacement
+) {
+	if(expression == nullptr) {
+		return nullptr;
+	}
+	if(expression == target) {
+		return replacement;
+	}
+	if(
+		!is_operation(expression) &&
+		expression->type() != "AssignationExpression" &&
+		expression->type() != "DeclarationExpression" &&
+		expression->type() != "ConditionnalStructure"
+	) {
+		return expression;
+	}
+	return daedalus::entropia::optimizer::map_children(
+		expression,
+		[&target, &replacement](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			return substitute_expression(child, target, replacement);
+		},
+		[](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			return body;
+		}
+	);
+}
+
+static void count_subexpressions(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	size_t statement,
+	std::unordered_map<daedalus::core::ast::Expression*, size_t>& available,
+	std::vector<CommonSubexpression>& subexpressions
+) {
+	if(!is_operation(expression)) {
+		return;
+	}
+
+	auto subexpression = available.find(expression.get());
+	if(subexpression != available.end()) {
+		// Its operands are reused with it
+		CommonSubexpression& common = subexpressions.at(subexpression->second);
+		common.uses++;
+		if(common.statements.back() != statement) {
+			common.statements.push_back(statement);
+		}
+		return;
+	}
+
+	auto inputs = std::unordered_set<std::string>();
+	collect_identifiers(expression, inputs);
+	subexpressions.push_back(CommonSubexpression{ expression, inputs, { statement }, 1 });
+	available[expression.get()] = subexpressions.size() - 1;
+
+	if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		count_subexpressions(unaryExpression->get_term(), statement, available, subexpressions);
+	}
+	if(auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression)) {
+		count_subexpressions(binaryExpression->get_left(), statement, available, subexpressions);
+		count_subexpressions(binaryExpression->get_right(), statement, available, subexpressions);
+	}
+}
+
+static std::string get_static_type(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)) {
+		return unaryExpression->get_static_type();
+	}
+	if(auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression)) {
+		return binaryExpression->get_static_type();
+	}
+	return "";
+}
+
+/**
+ * Hoisting must not raise an error the loop wouldn't, so a division needs a non zero literal divisor
+ */
+static bool can_raise(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	return contains_node(expression, [](std::shared_ptr<daedalus::core::ast::Expression> node) {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(node);
+		if(binaryExpression == nullptr || binaryExpression->get_operator_symbol() != "/") {
+			return false;
+		}
+		auto divisor = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(binaryExpression->get_right());
+		return divisor == nullptr || divisor->get_value() == 0;
+	});
+}
+
+/**
+ * Largest operations of the expression whose inputs aren't written by the loop
+ */
+static void collect_loop_invariants(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	const std::unordered_set<std::string>& writes,
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>>& invariants
+) {
+	if(expression == nullptr || expression->type() == "LazyScope") {
+		return;
+	}
+	if(is_operation(expression)) {
+		auto inputs = std::unordered_set<std::string>();
+		collect_identifiers(expression, inputs);
+		bool isInvariant = !inputs.empty() && std::none_of(inputs.begin(), inputs.end(), [&writes](const std::string& input) {
+			return writes.count(input) > 0;
+		});
+		if(isInvariant && !get_static_type(expression).empty() && !can_raise(expression)) {
+			if(std::find(invariants.begin(), invariants.end(), expression) == invariants.end()) {
+				invariants.push_back(expression);
+			}
+			return;
+		}
+	}
+	(void)daedalus::entropia::optimizer::map_children(
+		expression,
+		[&writes, &invariants](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			collect_loop_invariants(child, writes, invariants);
+			return child;
+		},
+		[&writes, &invariants](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			for(std::shared_ptr<daedalus::core::ast::Expression> child : body) {
+				collect_loop_invariants(child, writes, invariants);
+			}
+			return body;
+		}
+	);
+}
+
+/**
+ * Replace the target everywhere in the expression, nested bodies included
+ */
+static std::shared_ptr<daedalus::core::ast::Expression> replace_expression(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	std::shared_ptr<daedalus::core::ast::Expression> target,
+	std::shared_ptr<daedalus::core::ast::Expression> replacement
+) {
+	if(expression == target) {
+		return replacement;
+	}
+	if(expression == nullptr || expression->type() == "LazyScope") {
+		return expression;
+	}
+	return daedalus::entropia::optimizer::map_children(
+		expression,
+		[&target, &replacement](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			return replace_expression(child, target, replacement);
+		},
+		[&target, &replacement](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			for(std::shared_ptr<daedalus::core::ast::Expression>& child : body) {
+				child = replace_expression(child, target, replacement);
+			}
+			return body;
+		}
+	);
+}
+
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::optimizer::map_children(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	const daedalus::entropia::optimizer::ExpressionMapper& map_expression,
+	const daedalus::entropia::optimizer::BodyMapper& map_body
+) {
+	if(expression == nullptr) {
+		return nullptr;
+	}
+
+	std::string type = expression->type();
+
+	if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		std::shared_ptr<daedalus::core::ast::Expression> term = map_expression(unaryExpression->get_term());
+		if(term == unaryExpression->get_term()) {
+			return expression;
+		}
+		auto mappedExpression = std::make_shared<daedalus::entropia::ast::UnaryExpression>(term, unaryExpression->get_operator_symbol());
+		mappedExpression->set_static_type(unaryExpression->get_static_type());
+		return mappedExpression;
+	}
+	if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		std::shared_ptr<daedalus::core::ast::Expression> left = map_expression(binaryExpression->get_left());
+		std::shared_ptr<daedalus::core::ast::Expression> right = map_expression(binaryExpression->get_right());
+		if(left == binaryExpression->get_left() && right == binaryExpression->get_right()) {
+			return expression;
+		}
+		auto mappedExpression = std::make_shared<daedalus::entropia::ast::BinaryExpression>(left, binaryExpression->get_operator_symbol(), right);
+		mappedExpression->set_static_type(binaryExpression->get_static_type());
+		return mappedExpression;
+	}
+	if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		std::shared_ptr<daedalus::core::ast::Expression> value = map_expression(declarationExpression->get_value());
+		if(value == declarationExpression->get_value()) {
+			return expression;
+		}
+		auto mappedExpression = std::make_shared<daedalus::entropia::ast::DeclarationExpression>(
+			declarationExpression->get_identifier(),
+			value,
+			declarationExpression->get_value_type(),
+			declarationExpression->get_mutability(),
+			declarationExpression->get_hidden()
+		);
+		mappedExpression->set_static_type(declarationExpression->get_static_type());
+		return mappedExpression;
+	}
+	if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		std::shared_ptr<daedalus::core::ast::Expression> value = map_expression(assignationExpression->get_value());
+		if(value == assignationExpression->get_value()) {
+			return expression;
+		}
+		auto mappedExpression = std::make_shared<daedalus::entropia::ast::AssignationExpression>(assignationExpression->get_identifier(), value);
+		mappedExpression->set_static_type(assignationExpression->get_static_type());
+		return mappedExpression;
+	}
+	if(type == "OrExpression") {
+		auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression);
+		std::shared_ptr<daedalus::core::ast::Expression> value = map_expression(orExpression->get_value());
+		if(value == orExpression->get_value()) {
+			return expression;
+		}
+		return std::make_shared<daedalus::entropia::ast::OrExpression>(value);
+	}
+	if(type == "LoopExpression" || type == "WhileExpression" || type == "ForExpression" || type == "ParallelForExpression") {
+		auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression);
+		auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(expression);
+		auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(expression);
+
+		std::shared_ptr<daedalus::core::ast::Expression> initialExpression = forExpression != nullptr ? map_expression(forExpression->get_initial_expression()) : nullptr;
+		std::shared_ptr<daedalus::core::ast::Expression> condition = whileExpression != nullptr ? map_expression(whileExpression->get_condition()) : nullptr;
+		std::shared_ptr<daedalus::core::ast::Expression> updateExpression = forExpression != nullptr ? map_expression(forExpression->get_update_expression()) : nullptr;
+		std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body = map_body(loopExpression->get_body());
+		auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(map_expression(loopExpression->get_or_expression()));
+
+		if(
+			body == loopExpression->get_body() &&
+			orExpression == loopExpression->get_or_expression() &&
+			(whileExpression == nullptr || condition == whileExpression->get_condition()) &&
+			(forExpression == nullptr || (initialExpression == forExpression->get_initial_expression() && updateExpression == forExpression->get_update_expression()))
+		) {
+			return expression;
+		}
+
+		auto parallelForExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ParallelForExpression>(expression);
+		std::shared_ptr<daedalus::entropia::ast::LoopExpression> mappedExpression =
+			parallelForExpression != nullptr ?
+				std::make_shared<daedalus::entropia::ast::ParallelForExpression>(body, initialExpression, condition, updateExpression, parallelForExpression->get_reductions(), orExpression) :
+			forExpression != nullptr ?
+				std::make_shared<daedalus::entropia::ast::ForExpression>(body, initialExpression, condition, updateExpression, orExpression) :
+			whileExpression != nullptr ?
+				std::make_shared<daedalus::entropia::ast::WhileExpression>(body, condition, orExpression) :
+				std::make_shared<daedalus::entropia::ast::LoopExpression>(body, orExpression);
+		mappedExpression->set_static_type(loopExpression->get_static_type());
+		return mappedExpression;
+	}
+	if(type == "ConditionnalStructure") {
+		auto conditionnalStructure = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression);
+		auto expressions = std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>>();
+		std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> before = nullptr;
+		bool changed = false;
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : conditionnalStructure->get_expressions()) {
+			std::shared_ptr<daedalus::core::ast::Expression> condition = map_expression(conditionnalExpression->get_condition());
+			std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body = map_body(conditionnalExpression->get_body());
+			changed = changed || condition != conditionnalExpression->get_condition() || body != conditionnalExpression->get_body();
+			before = std::make_shared<daedalus::entropia::ast::ConditionnalExpression>(body, condition, before);
+			expressions.push_back(before);
+		}
+		if(!changed) {
+			return expression;
+		}
+		auto mappedExpression = std::make_shared<daedalus::entropia::ast::ConditionnalStructure>(expressions);
+		mappedExpression->set_static_type(conditionnalStructure->get_static_type());
+		return mappedExpression;
+	}
+
+	return expression;
+}
+
+std::string daedalus::entropia::optimizer::get_expression_key(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	std::string type = expression->type();
+
+	if(type == "NumberExpression") {
+		// Bit pattern, so every distinct double gets its own key
+		double value = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)->get_value();
+		uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return "N" + std::to_string(bits);
+	}
+	if(type == "BooleanExpression") {
+		return std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)->get_value() ? "T" : "F";
+	}
+	if(type == "CharExpression") {
+		return "C" + std::to_string(static_cast<unsigned char>(std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(expression)->get_value()));
+	}
+	if(type == "StrExpression") {
+		std::string value = std::dynamic_pointer_cast<daedalus::entropia::ast::StrExpression>(expression)->get_value();
+		return "S" + std::to_string(value.size()) + ":" + value;
+	}
+	if(type == "Identifier") {
+		// The same name can have another type in another scope
+		auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(expression);
+		return "I" + identifier->get_static_type() + ":" + identifier->get_name();
+	}
+	if(type == "UnaryExpression") {
+		auto unaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression);
+		return
+			"U" + unaryExpression->get_operator_symbol() + ":" + unaryExpression->get_static_type() + ":" +
+			get_pointer_key(unaryExpression->get_term());
+	}
+	if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		return
+			"O" + binaryExpression->get_operator_symbol() + ":" + binaryExpression->get_static_type() + ":" +
+			get_pointer_key(binaryExpression->get_left()) + ":" + get_pointer_key(binaryExpression->get_right());
+	}
+
+	return "";
+}
+
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::optimizer::share_expression(
+	std::shared_ptr<daedalus::core::ast::Expression> expression,
+	daedalus::entropia::optimizer::ExpressionPool& pool
+) {
+	if(expression == nullptr) {
+		return nullptr;
+	}
+
+	// Children first, the key of an operation uses the shared operands
+	expression = daedalus::entropia::optimizer::map_children(
+		expression,
+		[&pool](std::shared_ptr<daedalus::core::ast::Expression> child) {
+			return daedalus::entropia::optimizer::share_expression(child, pool);
+		},
+		[&pool](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+			for(std::shared_ptr<daedalus::core::ast::Expression>& child : body) {
+				child = daedalus::entropia::optimizer::share_expression(child, pool);
+			}
+			return body;
+		}
+	);
+
+	std::string key = daedalus::entropia::optimizer::get_expression_key(expression);
+	if(key.empty()) {
+		return expression;
+	}
+	return pool.emplace(key, expression).first->second;
+}
+
+std::vector<std::shared_ptr<daedalus::core::ast::Expression>> daedalus::entropia::optimizer::eliminate_common_subexpressions(
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+	daedalus::entropia::optimizer::ExpressionPool& pool,
+	daedalus::entropia::optimizer::TemporaryNames& names
+) {
+	// Nested scopes first, each one is its own straight-line region
+	std::function<std::shared_ptr<daedalus::core::ast::Expression>(std::shared_ptr<daedalus::core::ast::Expression>)> eliminate_in_expression;
+	eliminate_in_expression = [&pool, &names, &eliminate_in_expression](std::shared_ptr<daedalus::core::ast::Expression> expression) {
+		return daedalus::entropia::optimizer::map_children(
+			expression,
+			eliminate_in_expression,
+			[&pool, &names](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> scopeBody) {
+				return daedalus::entropia::optimizer::eliminate_common_subexpressions(scopeBody, pool, names);
+			}
+		);
+	};
+	for(std::shared_ptr<daedalus::core::ast::Expression>& expression : body) {
+		expression = daedalus::entropia::optimizer::share_expression(eliminate_in_expression(expression), pool);
+	}
+
+	while(true) {
+		auto subexpressions = std::vector<CommonSubexpression>();
+		auto available = std::unordered_map<daedalus::core::ast::Expression*, size_t>();
+
+		for(size_t i = 0; i < body.size(); i++) {
+			for(std::shared_ptr<daedalus::core::ast::Expression> expression : get_straight_line_expressions(body.at(i))) {
+				count_subexpressions(expression, i, available, subexpressions);
+			}
+
+			auto writes = std::unordered_set<std::string>();
+			bool writesAll = false;
+			collect_writes(body.at(i), writes, writesAll);
+
+			for(auto subexpression = available.begin(); subexpression != available.end();) {
+				const std::unordered_set<std::string>& inputs = subexpressions.at(subexpression->second).inputs;
+				bool isWritten = writesAll || std::any_of(inputs.begin(), inputs.end(), [&writes](const std::string& input) {
+					return writes.count(input) > 0;
+				});
+				subexpression = isWritten ? available.erase(subexpression) : std::next(subexpression);
+			}
+		}
+
+		// Largest first, its operands are then reused with it
+		CommonSubexpression* best = nullptr;
+		size_t bestOperationCount = 0;
+		for(CommonSubexpression& subexpression : subexpressions) {
+			size_t operationCount = get_operation_count(subexpression.expression);
+			// Worth a declaration when at least two operations are saved
+			if(
+				operationCount * (subexpression.uses - 1) >= 2 &&
+				operationCount > bestOperationCount &&
+				!get_static_type(subexpression.expression).empty()
+			) {
+				best = &subexpression;
+				bestOperationCount = operationCount;
+			}
+		}
+		if(best == nullptr) {
+			return body;
+		}
+
+		std::string type = get_static_type(best->expression);
+		auto identifier = std::make_shared<daedalus::entropia::ast::Identifier>("__cse" + std::to_string(names.commonSubexpressionCount++));
+		identifier->set_static_type(type);
+		auto sharedIdentifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(
+			daedalus::entropia::optimizer::share_expression(identifier, pool)
+		);
+
+		auto declarationExpression = std::make_shared<daedalus::entropia::ast::DeclarationExpression>(sharedIdentifier, best->expression, type, false, true);
+		declarationExpression->set_static_type(type);
+
+		for(size_t statement : best->statements) {
+			body.at(statement) = daedalus::entropia::optimizer::share_expression(
+				substitute_expression(body.at(statement), best->expression, sharedIdentifier),
+				pool
+			);
+		}
+		body.insert(body.begin() + best->statements.front(), declarationExpression);
+	}
+}
+
+std::vector<std::shared_ptr<daedalus::core::ast::Expression>> daedalus::entropia::optimizer::hoist_loop_invariants(
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+	daedalus::entropia::optimizer::ExpressionPool& pool,
+	daedalus::entropia::optimizer::TemporaryNames& names
+) {
+	// Inner loops first, their pre-headers can then be hoisted out of the outer loops
+	std::function<std::shared_ptr<daedalus::core::ast::Expression>(std::shared_ptr<daedalus::core::ast::Expression>)> hoist_in_expression;
+	hoist_in_expression = [&pool, &names, &hoist_in_expression](std::shared_ptr<daedalus::core::ast::Expression> expression) {
+		return daedalus::entropia::optimizer::map_children(
+			expression,
+			hoist_in_expression,
+			[&pool, &names](std::vector<std::shared_ptr<daedalus::core::ast::Expression>> scopeBody) {
+				return daedalus::entropia::optimizer::hoist_loop_invariants(scopeBody, pool, names);
+			}
+		);
+	};
+
+	auto hoistedBody = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		expression = hoist_in_expression(expression);
+
+		auto loopExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression);
+		if(loopExpression == nullptr) {
+			hoistedBody.push_back(expression);
+			continue;
+		}
+
+		// Assigned or declared anywhere in the loop, the for loop variable included
+		auto writes = std::unordered_set<std::string>();
+		bool writesAll = false;
+		collect_writes(loopExpression, writes, writesAll);
+		if(writesAll) {
+			hoistedBody.push_back(expression);
+			continue;
+		}
+
+		// Only what runs at each iteration, the initial and or expressions run once anyway
+		auto invariants = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+		if(auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(loopExpression)) {
+			collect_loop_invariants(whileExpression->get_condition(), writes, invariants);
+		}
+		if(auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(loopExpression)) {
+			collect_loop_invariants(forExpression->get_update_expression(), writes, invariants);
+		}
+		for(std::shared_ptr<daedalus::core::ast::Expression> statement : loopExpression->get_body()) {
+			collect_loop_invariants(statement, writes, invariants);
+		}
+
+		// Largest first, an invariant can be an operand of another one
+		std::stable_sort(
+			invariants.begin(),
+			invariants.end(),
+			[](std::shared_ptr<daedalus::core::ast::Expression> left, std::shared_ptr<daedalus::core::ast::Expression> right) {
+				return get_operation_count(left) > get_operation_count(right);
+			}
+		);
+		for(std::shared_ptr<daedalus::core::ast::Expression> invariant : invariants) {
+			std::string type = get_static_type(invariant);
+			auto identifier = std::make_shared<daedalus::entropia::ast::Identifier>("__licm" + std::to_string(names.loopInvariantCount++));
+			identifier->set_static_type(type);
+			auto sharedIdentifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(
+				daedalus::entropia::optimizer::share_expression(identifier, pool)
+			);
+
+			auto declarationExpression = std::make_shared<daedalus::entropia::ast::DeclarationExpression>(sharedIdentifier, invariant, type, false, true);
+			declarationExpression->set_static_type(type);
+			hoistedBody.push_back(declarationExpression);
+
+			expression = replace_expression(expression, invariant, sharedIdentifier);
+		}
+		hoistedBody.push_back(expression);
+	}
+	return hoistedBody;
+}
+
+bool daedalus::entropia::optimizer::is_optimizer_enabled() {
+	const char* optimize = std::getenv("ENTROPIA_OPTIMIZE");
+	return optimize == nullptr || std::string(optimize) != "0";
+}
+
+std::vector<std::shared_ptr<daedalus::core::ast::Expression>> daedalus::entropia::optimizer::optimize_body(
+	std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+	daedalus::entropia::optimizer::TemporaryNames& names
+) {
+	if(!daedalus::entropia::optimizer::is_optimizer_enabled()) {
+		return body;
+	}
+
+	auto pool = daedalus::entropia::optimizer::ExpressionPool();
+	return daedalus::entropia::optimizer::hoist_loop_invariants(
+		daedalus::entropia::optimizer::eliminate_common_subexpressions(
+			daedalus::entropia::ast::get_constexpr_body(body),
+			pool,
+			names
+		),
+		pool,
+		names
+	);
+}
+
+std::shared_ptr<daedalus::core::ast::Scope> daedalus::entropia::optimizer::optimize(std::shared_ptr<daedalus::core::ast::Scope> program) {
+	auto names = daedalus::entropia::optimizer::TemporaryNames();
+	return std::make_shared<daedalus::core::ast::Scope>(
+		daedalus::entropia::optimizer::optimize_body(program->get_body(), names)
+	);
+}
+
+std::shared_ptr<daedalus::entropia::ast::CountedLoop> daedalus::entropia::optimizer::get_counted_loop(std::shared_ptr<daedalus::entropia::ast::ForExpression> forExpression) {
+	// let mut i: <integer> = ...
+	auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(forExpression->get_initial_expression());
+	if(declarationExpression == nullptr || !declarationExpression->get_mutability()) {
+		return nullptr;
+	}
+	std::string valueType = declarationExpression->get_value_type();
+	if(!daedalus::entropia::checker::is_number_type(valueType) || (valueType.at(0) != 'i' && valueType.at(0) != 'u')) {
+		return nullptr;
+	}
+	std::string name = declarationExpression->get_identifier()->get_name();
+
+	// i <op> <literal / identifier>
+	auto condition = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(forExpression->get_condition());
+	if(condition == nullptr) {
+		return nullptr;
+	}
+	std::string comparison = condition->get_operator_symbol();
+	auto conditionIdentifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(condition->get_left());
+	auto boundIdentifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(condition->get_right());
+	if(
+		(comparison != "<" && comparison != "<=" && comparison != ">" && comparison != ">=") ||
+		conditionIdentifier == nullptr || conditionIdentifier->get_name() != name ||
+		(condition->get_right()->type() != "NumberExpression" && boundIdentifier == nullptr) ||
+		(boundIdentifier != nullptr && boundIdentifier->get_name() == name)
+	) {
+		return nullptr;
+	}
+
+	// i = i +/- <literal>
+	auto updateExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(forExpression->get_update_expression());
+	if(updateExpression == nullptr || updateExpression->type() != "AssignationExpression" || updateExpression->get_identifier()->get_name() != name) {
+		return nullptr;
+	}
+	auto step = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(updateExpression->get_value());
+	if(step == nullptr || (step->get_operator_symbol() != "+" && step->get_operator_symbol() != "-")) {
+		return nullptr;
+	}
+	auto stepIdentifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(step->get_left());
+	auto stepValue = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(step->get_right());
+	if(stepIdentifier == nullptr || stepIdentifier->get_name() != name || stepValue == nullptr) {
+		return nullptr;
+	}
+
+	// The body can't move the variable nor the bound, nor skip the update with continue
+	auto writes = std::unordered_set<std::string>();
+	bool writesAll = false;
+	bool hasContinue = false;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : forExpression->get_body()) {
+		collect_writes(expression, writes, writesAll);
+		hasContinue = hasContinue || contains_node(expression, [](std::shared_ptr<daedalus::core::ast::Expression> node) {
+			return node->type() == "ContinueExpression";
+		});
+	}
+	if(writesAll || hasContinue || writes.count(name) > 0 || (boundIdentifier != nullptr && writes.count(boundIdentifier->get_name()) > 0)) {
+		return nullptr;
+	}
+
+	bool isRead = false;
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : forExpression->get_body()) {
+		isRead = isRead || contains_node(expression, [&name](std::shared_ptr<daedalus::core::ast::Expression> node) {
+			auto identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::Identifier>(node);
+			return identifier != nullptr && identifier->get_name() == name;
+		});
+	}
+
+	return std::make_shared<daedalus::entropia::ast::CountedLoop>(daedalus::entropia::ast::CountedLoop{
+		name,
+		comparison,
+		condition->get_right(),
+		step->get_operator_symbol() == "+" ? stepValue->get_value() : -stepValue->get_value(),
+		isRead
+	});
+}
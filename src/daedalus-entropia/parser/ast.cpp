@@ -1,12 +1,72 @@
 #include <daedalus/Entropia/parser/ast.hpp>
 
+#pragma region Constexpr
+
+bool daedalus::entropia::ast::is_literal(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	return
+		expression->type() == "NumberExpression" ||
+		expression->type() == "BooleanExpression" ||
+		expression->type() == "CharExpression" ||
+		expression->type() == "StrExpression";
+}
+
+bool daedalus::entropia::ast::literal_is_true(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(auto numberExpression = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(expression)) {
+		return numberExpression->get_value() != 0;
+	}
+	if(auto booleanExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BooleanExpression>(expression)) {
+		return booleanExpression->get_value();
+	}
+	if(auto charExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::CharExpression>(expression)) {
+		return charExpression->get_value() != '\0';
+	}
+	if(auto strExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::StrExpression>(expression)) {
+		return !strExpression->get_value().empty();
+	}
+	throw std::runtime_error("Trying to get the boolean value of non literal expression " + expression->repr());
+}
+
+std::shared_ptr<daedalus::entropia::ast::BooleanExpression> daedalus::entropia::ast::get_boolean_literal(bool value) {
+	static const std::shared_ptr<daedalus::entropia::ast::BooleanExpression> trueLiteral = std::make_shared<daedalus::entropia::ast::BooleanExpression>(true);
+	static const std::shared_ptr<daedalus::entropia::ast::BooleanExpression> falseLiteral = std::make_shared<daedalus::entropia::ast::BooleanExpression>(false);
+	return value ? trueLiteral : falseLiteral;
+}
+
+std::vector<std::shared_ptr<daedalus::core::ast::Expression>> daedalus::entropia::ast::get_constexpr_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+	auto constexprBody = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : body) {
+		constexprBody.push_back(expression->get_constexpr());
+		if(
+			constexprBody.back()->type() == "BreakExpression" ||
+			constexprBody.back()->type() == "ContinueExpression"
+		) {
+			break;
+		}
+	}
+	return constexprBody;
+}
+
+bool daedalus::entropia::ast::is_hidden(std::shared_ptr<daedalus::core::ast::Expression> statement) {
+	if(statement->type() != "DeclarationExpression") {
+		return false;
+	}
+	return std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(statement)->get_hidden();
+}
+
+#pragma endregion
+
 #pragma region DeclarationExpression
 
-daedalus::entropia::ast::DeclarationExpression::DeclarationExpression(std::shared_ptr<Identifier> identifier, std::shared_ptr<daedalus::core::ast::Expression> value, std::string value_type, bool isMutable) :
+daedalus::entropia::ast::DeclarationExpression::DeclarationExpression(std::shared_ptr<Identifier> identifier, std::shared_ptr<daedalus::core::ast::Expression> value, std::string value_type, bool isMutable, bool isHidden) :
 	AssignationExpression(identifier, value),
 	value_type(value_type),
-	isMutable(isMutable)
-{}
+	isMutable(isMutable),
+	isHidden(isHidden)
+{
+	if(isHidden) {
+		identifier->set_hidden_value(value);
+	}
+}
 
 std::string daedalus::entropia::ast::DeclarationExpression::get_value_type() {
 	return this->value_type;
@@ -14,6 +74,9 @@ std::string daedalus::entropia::ast::DeclarationExpression::get_value_type() {
 bool daedalus::entropia::ast::DeclarationExpression::get_mutability() {
 	return this->isMutable;
 }
+bool daedalus::entropia::ast::DeclarationExpression::get_hidden() {
+	return this->isHidden;
+}
 
 std::string daedalus::entropia::ast::DeclarationExpression::type() {
 	return "DeclarationExpression";
@@ -49,6 +112,12 @@ std::shared_ptr<daedalus::entropia::ast::Identifier> daedalus::entropia::ast::As
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::AssignationExpression::get_value() {
 	return this->value;
 }
+std::string daedalus::entropia::ast::AssignationExpression::get_static_type() {
+	return this->staticType;
+}
+void daedalus::entropia::ast::AssignationExpression::set_static_type(std::string static_type) {
+	this->staticType = static_type;
+}
 
 std::string daedalus::entropia::ast::AssignationExpression::type() {
 	return "AssignationExpression";
@@ -76,6 +145,15 @@ daedalus::entropia::ast::Identifier::Identifier(std::string name) :
 std::string daedalus::entropia::ast::Identifier::get_name() {
 	return this->name;
 }
+std::string daedalus::entropia::ast::Identifier::get_static_type() {
+	return this->staticType;
+}
+void daedalus::entropia::ast::Identifier::set_static_type(std::string static_type) {
+	this->staticType = static_type;
+}
+void daedalus::entropia::ast::Identifier::set_hidden_value(std::shared_ptr<daedalus::core::ast::Expression> hidden_value) {
+	this->hiddenValue = hidden_value;
+}
 std::string daedalus::entropia::ast::Identifier::type() {
 	return "Identifier";
 }
@@ -83,6 +161,9 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::Identi
 	return this->shared_from_this();
 }
 std::string daedalus::entropia::ast::Identifier::repr(int indent) {
+	if(this->hiddenValue != nullptr) {
+		return this->hiddenValue->repr(indent);
+	}
 	return std::string(indent, '\t') + this->name;
 }
 
@@ -143,10 +224,14 @@ std::string daedalus::entropia::ast::CharExpression::repr(int indent) {
 
 daedalus::entropia::ast::StrExpression::StrExpression(std::string value) :
 	Expression(),
-	value(value)
+	value(std::make_shared<daedalus::entropia::values::StrValue>(daedalus::entropia::values::intern_string(value), true))
 {}
 
 std::string daedalus::entropia::ast::StrExpression::get_value() {
+	return this->value->get();
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::ast::StrExpression::get_runtime_value() {
 	return this->value;
 }
 
@@ -157,7 +242,7 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::StrExp
 	return this->shared_from_this();
 }
 std::string daedalus::entropia::ast::StrExpression::repr(int indent) {
-	return std::string(indent, '\t') + "\"" + this->value + "\"";
+	return std::string(indent, '\t') + "\"" + this->value->get() + "\"";
 }
 
 #pragma region ContainerExpression
@@ -186,6 +271,12 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::UnaryE
 std::string daedalus::entropia::ast::UnaryExpression::get_operator_symbol() {
 	return this->operator_symbol;
 }
+std::string daedalus::entropia::ast::UnaryExpression::get_static_type() {
+	return this->staticType;
+}
+void daedalus::entropia::ast::UnaryExpression::set_static_type(std::string static_type) {
+	this->staticType = static_type;
+}
 
 std::shared_ptr<daedalus::entropia::ast::Identifier> daedalus::entropia::ast::UnaryExpression::get_inner_identifier() {
 
@@ -206,11 +297,9 @@ std::string daedalus::entropia::ast::UnaryExpression::type() {
 }
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::UnaryExpression::get_constexpr() {
 	this->term = this->term->get_constexpr();
-	if(auto booleanExpression = std::dynamic_pointer_cast<BooleanExpression>(this->term)) {
-		if(this->operator_symbol == "!") {
-			booleanExpression->set_value(!booleanExpression->get_value());
-			return booleanExpression;
-		}
+	// A new literal, the term can be shared by other expressions
+	if(is_literal(this->term) && this->operator_symbol == "!") {
+		return daedalus::entropia::ast::get_boolean_literal(!literal_is_true(this->term));
 	}
 	return this->shared_from_this();
 }
@@ -234,7 +323,10 @@ daedalus::entropia::ast::BinaryExpression::BinaryExpression(
 	ContainerExpression(),
 	left(left),
 	operator_symbol(operator_symbol),
-	right(right)
+	right(right),
+	staticType(),
+	quickenedOperation(nullptr),
+	isDeoptimized(false)
 {}
 
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::BinaryExpression::get_left() {
@@ -246,6 +338,28 @@ std::string daedalus::entropia::ast::BinaryExpression::get_operator_symbol() {
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::BinaryExpression::get_right() {
 	return this->right;
 }
+std::string daedalus::entropia::ast::BinaryExpression::get_static_type() {
+	return this->staticType;
+}
+void daedalus::entropia::ast::BinaryExpression::set_static_type(std::string static_type) {
+	this->staticType = static_type;
+}
+
+daedalus::entropia::ast::QuickenedOperation daedalus::entropia::ast::BinaryExpression::get_quickened_operation() {
+	return this->quickenedOperation.load(std::memory_order_relaxed);
+}
+void daedalus::entropia::ast::BinaryExpression::quicken(daedalus::entropia::ast::QuickenedOperation quickened_operation) {
+	if(!this->isDeoptimized.load(std::memory_order_relaxed)) {
+		this->quickenedOperation.store(quickened_operation, std::memory_order_relaxed);
+	}
+}
+void daedalus::entropia::ast::BinaryExpression::deoptimize() {
+	this->isDeoptimized.store(true, std::memory_order_relaxed);
+	this->quickenedOperation.store(nullptr, std::memory_order_relaxed);
+}
+bool daedalus::entropia::ast::BinaryExpression::is_deoptimized() {
+	return this->isDeoptimized.load(std::memory_order_relaxed);
+}
 
 std::shared_ptr<daedalus::entropia::ast::Identifier> daedalus::entropia::ast::BinaryExpression::get_inner_identifier() {
 	std::shared_ptr<daedalus::entropia::ast::Identifier> leftIdentifier = this->left_contains_identifier();
@@ -263,6 +377,17 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::Binary
 	this->left = this->left->get_constexpr();
 	this->right = this->right->get_constexpr();
 
+	if(!is_literal(left) || !is_literal(right)) {
+		return this->shared_from_this();
+	}
+
+	if(this->operator_symbol == "&&") {
+		return daedalus::entropia::ast::get_boolean_literal(literal_is_true(left) && literal_is_true(right));
+	}
+	if(this->operator_symbol == "||") {
+		return daedalus::entropia::ast::get_boolean_literal(literal_is_true(left) || literal_is_true(right));
+	}
+
 	if(left->type() == "NumberExpression" && right->type() == "NumberExpression") {
 		auto leftNb = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(left);
 		auto rightNb = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(right);
@@ -282,58 +407,58 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::Binary
 			)
 			return std::make_shared<daedalus::core::ast::NumberExpression>(leftNb->get_value() / rightNb->get_value());
 		}
-		if(this->operator_symbol == "&&") {
-			return std::make_shared<BooleanExpression>(leftNb->get_value() && rightNb->get_value());
+		if(this->operator_symbol == "==") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() == rightNb->get_value());
+		}
+		if(this->operator_symbol == "!=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() != rightNb->get_value());
+		}
+		if(this->operator_symbol == "<") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() < rightNb->get_value());
+		}
+		if(this->operator_symbol == ">") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() > rightNb->get_value());
 		}
-		if(this->operator_symbol == "||") {
-			return std::make_shared<BooleanExpression>(leftNb->get_value() || rightNb->get_value());
+		if(this->operator_symbol == "<=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() <= rightNb->get_value());
+		}
+		if(this->operator_symbol == ">=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftNb->get_value() >= rightNb->get_value());
 		}
 		throw std::runtime_error("Invalid operator for NumberExpression and NumberExpression");
 	}
 	if(left->type() == "BooleanExpression" && right->type() == "BooleanExpression") {
 		auto leftBool = std::dynamic_pointer_cast<BooleanExpression>(left);
 		auto rightBool = std::dynamic_pointer_cast<BooleanExpression>(right);
-		if(this->operator_symbol == "&&") {
-			return std::make_shared<BooleanExpression>(leftBool->get_value() && rightBool->get_value());
+		if(this->operator_symbol == "==") {
+			return daedalus::entropia::ast::get_boolean_literal(leftBool->get_value() == rightBool->get_value());
 		}
-		if(this->operator_symbol == "||") {
-			return std::make_shared<BooleanExpression>(leftBool->get_value() || rightBool->get_value());
+		if(this->operator_symbol == "!=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftBool->get_value() != rightBool->get_value());
 		}
 		throw std::runtime_error("Invalid operator for BooleanExpression and BooleanExpression");
 	}
-	if(left->type() == "NumberExpression" && right->type() == "BooleanExpression") {
-		auto leftNb = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(left);
-		auto rightBool = std::dynamic_pointer_cast<BooleanExpression>(right);
-		if(this->operator_symbol == "&&") {
-			return std::make_shared<BooleanExpression>(leftNb->get_value() && rightBool->get_value());
+	if(left->type() == "CharExpression" && right->type() == "CharExpression") {
+		auto leftChar = std::dynamic_pointer_cast<CharExpression>(left);
+		auto rightChar = std::dynamic_pointer_cast<CharExpression>(right);
+		if(this->operator_symbol == "==") {
+			return daedalus::entropia::ast::get_boolean_literal(leftChar->get_value() == rightChar->get_value());
 		}
-		if(this->operator_symbol == "||") {
-			return std::make_shared<BooleanExpression>(leftNb->get_value() || rightBool->get_value());
+		if(this->operator_symbol == "!=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftChar->get_value() != rightChar->get_value());
 		}
-		throw std::runtime_error("Invalid operator for NumberExpression and BooleanExpression");
+		throw std::runtime_error("Invalid operator for CharExpression and CharExpression");
 	}
-	if(left->type() == "BooleanExpression" && right->type() == "NumberExpression") {
-		auto leftBool = std::dynamic_pointer_cast<BooleanExpression>(left);
-		auto rightNb = std::dynamic_pointer_cast<daedalus::core::ast::NumberExpression>(right);
-		if(this->operator_symbol == "&&") {
-			return std::make_shared<BooleanExpression>(leftBool->get_value() && rightNb->get_value());
+	if(left->type() == "StrExpression" && right->type() == "StrExpression") {
+		auto leftStr = std::dynamic_pointer_cast<StrExpression>(left);
+		auto rightStr = std::dynamic_pointer_cast<StrExpression>(right);
+		if(this->operator_symbol == "==") {
+			return daedalus::entropia::ast::get_boolean_literal(leftStr->get_value() == rightStr->get_value());
 		}
-		if(this->operator_symbol == "||") {
-			return std::make_shared<BooleanExpression>(leftBool->get_value() || rightNb->get_value());
+		if(this->operator_symbol == "!=") {
+			return daedalus::entropia::ast::get_boolean_literal(leftStr->get_value() != rightStr->get_value());
 		}
-		throw std::runtime_error("Invalid operator for BooleanExpression and NumberExpression");
-	}
-
-	if(
-		left->type() == "Identifier" || right->type() == "Identifier" ||
-		left->type() == "BinaryExpression" || right->type() == "BinaryExpression" ||
-		left->type() == "UnaryExpression" || right->type() == "UnaryExpression"
-	) {
-		return std::make_shared<daedalus::entropia::ast::BinaryExpression>(
-			left,
-			this->operator_symbol,
-			right
-		);
+		throw std::runtime_error("Invalid operator for StrExpression and StrExpression");
 	}
 
 	throw std::runtime_error("Invalid operands " + this->left->repr() + " " + this->right->repr());
@@ -410,10 +535,23 @@ daedalus::entropia::ast::LoopExpression::LoopExpression(
 std::shared_ptr<daedalus::entropia::ast::OrExpression> daedalus::entropia::ast::LoopExpression::get_or_expression() {
     return this->orExpression;
 }
+std::string daedalus::entropia::ast::LoopExpression::get_static_type() {
+    return this->staticType;
+}
+void daedalus::entropia::ast::LoopExpression::set_static_type(std::string static_type) {
+    this->staticType = static_type;
+}
 
 std::string daedalus::entropia::ast::LoopExpression::type() {
     return "LoopExpression";
 }
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::LoopExpression::get_constexpr() {
+    this->body = daedalus::entropia::ast::get_constexpr_body(this->body);
+    if(this->orExpression != nullptr) {
+        this->orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(this->orExpression->get_constexpr());
+    }
+    return this->shared_from_this();
+}
 
 std::string daedalus::entropia::ast::LoopExpression::repr(int indent) {
     std::string pretty = std::string(indent, '\t') + "loop {\n";
@@ -451,6 +589,18 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::WhileE
 std::string daedalus::entropia::ast::WhileExpression::type() {
     return "WhileExpression";
 }
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::WhileExpression::get_constexpr() {
+    this->condition = this->condition->get_constexpr();
+    if(
+        this->orExpression != nullptr &&
+        daedalus::entropia::ast::is_literal(this->condition) &&
+        !daedalus::entropia::ast::literal_is_true(this->condition)
+    ) {
+        // The body can never run, the loop is its or value
+        return this->orExpression->get_value()->get_constexpr();
+    }
+    return daedalus::entropia::ast::LoopExpression::get_constexpr();
+}
 
 std::string daedalus::entropia::ast::WhileExpression::repr(int indent) {
     std::string pretty = std::string(indent, '\t') + "while(\n";
@@ -483,7 +633,9 @@ daedalus::entropia::ast::ForExpression::ForExpression(
 ) :
     daedalus::entropia::ast::WhileExpression(body, condition, orExpression),
     initialExpression(initial_expression),
-    updateExpression(update_expression)
+    updateExpression(update_expression),
+    countedLoop(nullptr),
+    countedLoopAnalysis()
 {}
 
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::ForExpression::get_initial_expression() {
@@ -494,9 +646,37 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::ForExp
     return this->updateExpression;
 }
 
+std::shared_ptr<daedalus::entropia::ast::CountedLoop> daedalus::entropia::ast::ForExpression::get_counted_loop() {
+    return this->countedLoop;
+}
+
+void daedalus::entropia::ast::ForExpression::analyze_counted_loop(const std::function<std::shared_ptr<daedalus::entropia::ast::CountedLoop>()>& analysis) {
+    std::call_once(this->countedLoopAnalysis, [this, &analysis]() {
+        this->countedLoop = analysis();
+    });
+}
+
 std::string daedalus::entropia::ast::ForExpression::type() {
     return "ForExpression";
 }
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::ForExpression::get_constexpr() {
+    this->initialExpression = this->initialExpression->get_constexpr();
+    this->condition = this->condition->get_constexpr();
+    this->updateExpression = this->updateExpression->get_constexpr();
+
+    auto initialDeclaration = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(this->initialExpression);
+    if(
+        this->orExpression != nullptr &&
+        initialDeclaration != nullptr &&
+        daedalus::entropia::ast::is_literal(initialDeclaration->get_value()) &&
+        daedalus::entropia::ast::is_literal(this->condition) &&
+        !daedalus::entropia::ast::literal_is_true(this->condition)
+    ) {
+        // The initial expression only declares a loop local value, the loop is its or value
+        return this->orExpression->get_value()->get_constexpr();
+    }
+    return daedalus::entropia::ast::LoopExpression::get_constexpr();
+}
 
 std::string daedalus::entropia::ast::ForExpression::repr(int indent) {
     std::string pretty = std::string(indent, '\t') + "for(\n";
@@ -521,6 +701,61 @@ std::string daedalus::entropia::ast::ForExpression::repr(int indent) {
 
 #pragma endregion
 
+#pragma region ParallelForExpression
+
+daedalus::entropia::ast::ParallelForExpression::ParallelForExpression(
+    std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+    std::shared_ptr<daedalus::core::ast::Expression> initial_expression,
+    std::shared_ptr<daedalus::core::ast::Expression> condition,
+    std::shared_ptr<daedalus::core::ast::Expression> update_expression,
+    std::vector<daedalus::entropia::ast::Reduction> reductions,
+    std::shared_ptr<daedalus::entropia::ast::OrExpression> orExpression
+) :
+    daedalus::entropia::ast::ForExpression(body, initial_expression, condition, update_expression, orExpression),
+    reductions(reductions)
+{}
+
+std::vector<daedalus::entropia::ast::Reduction> daedalus::entropia::ast::ParallelForExpression::get_reductions() {
+    return this->reductions;
+}
+
+std::string daedalus::entropia::ast::ParallelForExpression::type() {
+    return "ParallelForExpression";
+}
+
+std::string daedalus::entropia::ast::ParallelForExpression::repr(int indent) {
+    std::string pretty = std::string(indent, '\t') + "par for(\n";
+
+    pretty += this->initialExpression->repr(indent + 1) + "\n" + std::string(indent + 1, '\t') + ";\n";
+    pretty += this->condition->repr(indent + 1) + "\n" + std::string(indent + 1, '\t') + ";\n";
+    pretty += this->updateExpression->repr(indent + 1) + "\n";
+    pretty += std::string(indent, '\t') + ")";
+
+    if(!this->reductions.empty()) {
+        pretty += " reduce(";
+        for(size_t i = 0; i < this->reductions.size(); i++) {
+            pretty += (i == 0 ? "" : ", ") + this->reductions.at(i).name + ": " + this->reductions.at(i).operator_symbol;
+        }
+        pretty += ")";
+    }
+
+    pretty += " {\n";
+
+	for(std::shared_ptr<daedalus::core::ast::Expression> expression : this->body) {
+		pretty += expression->repr(indent + 1) + "\n";
+	}
+
+	pretty += std::string(indent, '\t') + "}";
+
+	if(this->orExpression != nullptr) {
+	    pretty += " " + this->orExpression->repr();
+	}
+
+	return pretty;
+}
+
+#pragma endregion
+
 #pragma region BreakExpression
 
 daedalus::entropia::ast::BreakExpression::BreakExpression() {}
@@ -576,14 +811,23 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::Condit
 std::string daedalus::entropia::ast::ConditionnalExpression::type() {
     return "ConditionnalExpression";
 }
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::ConditionnalExpression::get_constexpr() {
+    if(this->condition != nullptr) {
+        this->condition = this->condition->get_constexpr();
+    }
+    this->body = daedalus::entropia::ast::get_constexpr_body(this->body);
+    return this->shared_from_this();
+}
 
 std::string daedalus::entropia::ast::ConditionnalExpression::repr(int indent) {
     std::string pretty =
         std::string(indent, '\t') +
-        std::string(this->before == nullptr ?
-            "if (\n" + this->condition->repr(indent + 1) + "\n" + std::string(indent, '\t') + ")":
-            this->condition == nullptr ?
+        std::string(this->condition == nullptr ?
+            this->before == nullptr ?
+                "" :
                 "else" :
+            this->before == nullptr ?
+                "if (\n" + this->condition->repr(indent + 1) + "\n" + std::string(indent, '\t') + ")":
                 "else if (\n" + this->condition->repr(indent + 1) + "\n" + std::string(indent, '\t') + ")"
         ) + " {\n";
 
@@ -609,20 +853,47 @@ daedalus::entropia::ast::ConditionnalStructure::ConditionnalStructure(
 std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>> daedalus::entropia::ast::ConditionnalStructure::get_expressions() {
     return this->expressions;
 }
+std::string daedalus::entropia::ast::ConditionnalStructure::get_static_type() {
+    return this->staticType;
+}
+void daedalus::entropia::ast::ConditionnalStructure::set_static_type(std::string static_type) {
+    this->staticType = static_type;
+}
 
 std::string daedalus::entropia::ast::ConditionnalStructure::type() {
     return "ConditionnalStructure";
 }
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::ConditionnalStructure::get_constexpr() {
     std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>> expressions;
+    std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> before = nullptr;
     for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : this->expressions) {
-        expressions.push_back(
-            std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalExpression>(
-                conditionnalExpression->get_constexpr()
-            )
+        conditionnalExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalExpression>(
+            conditionnalExpression->get_constexpr()
+        );
+
+        std::shared_ptr<daedalus::core::ast::Expression> condition = conditionnalExpression->get_condition();
+        if(condition != nullptr && daedalus::entropia::ast::is_literal(condition)) {
+            if(!daedalus::entropia::ast::literal_is_true(condition)) {
+                continue;
+            }
+            condition = nullptr;
+        }
+
+        before = std::make_shared<daedalus::entropia::ast::ConditionnalExpression>(
+            conditionnalExpression->get_body(),
+            condition,
+            before
         );
+        expressions.push_back(before);
+
+        if(condition == nullptr) {
+            break;
+        }
+    }
+    // If every branch is dead, keep them so the runtime still reports that no condition matched
+    if(expressions.size() > 0) {
+        this->expressions = expressions;
     }
-    this->expressions = expressions;
     return this->shared_from_this();
 }
 std::string daedalus::entropia::ast::ConditionnalStructure::repr(int indent) {
@@ -634,3 +905,73 @@ std::string daedalus::entropia::ast::ConditionnalStructure::repr(int indent) {
 }
 
 #pragma endregion
+
+#pragma region LazyScope
+
+daedalus::entropia::ast::LazyScope::LazyScope(
+    std::vector<daedalus::core::lexer::Token> tokens,
+    daedalus::core::parser::Parser* parser,
+    std::unordered_map<std::string, std::string> identifiers
+) :
+    daedalus::core::ast::Scope(),
+    tokens(tokens),
+    parser(parser),
+    identifiers(identifiers),
+    deferredCheck(),
+    parsed(false)
+{}
+
+std::vector<daedalus::core::lexer::Token> daedalus::entropia::ast::LazyScope::get_tokens() {
+    return this->tokens;
+}
+
+daedalus::core::parser::Parser* daedalus::entropia::ast::LazyScope::get_parser() {
+    return this->parser;
+}
+
+std::unordered_map<std::string, std::string> daedalus::entropia::ast::LazyScope::get_identifiers() {
+    return this->identifiers;
+}
+
+daedalus::entropia::ast::DeferredCheck daedalus::entropia::ast::LazyScope::get_deferred_check() {
+    return this->deferredCheck;
+}
+
+void daedalus::entropia::ast::LazyScope::set_deferred_check(daedalus::entropia::ast::DeferredCheck deferred_check) {
+    this->deferredCheck = deferred_check;
+}
+
+bool daedalus::entropia::ast::LazyScope::is_parsed() {
+    return this->parsed;
+}
+
+void daedalus::entropia::ast::LazyScope::set_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body) {
+    this->body = body;
+    this->parsed = true;
+    // The tokens aren't needed anymore once parsed
+    this->tokens.clear();
+    this->identifiers.clear();
+}
+
+std::string daedalus::entropia::ast::LazyScope::type() {
+    return "LazyScope";
+}
+std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::ast::LazyScope::get_constexpr() {
+    // The body is folded when it gets parsed
+    return this->shared_from_this();
+}
+std::string daedalus::entropia::ast::LazyScope::repr(int indent) {
+    if(!this->parsed) {
+        return std::string(indent, '\t') + "<lazy " + std::to_string(this->tokens.size()) + " tokens>";
+    }
+
+    std::string pretty = "";
+
+    for(std::shared_ptr<daedalus::core::ast::Expression> expression : this->body) {
+		pretty += (pretty.empty() ? "" : "\n") + expression->repr(indent);
+	}
+
+	return pretty;
+}
+
+#pragma endregion
@@ -83,7 +83,9 @@ char get_char(std::string src) {
 	return src.at(0);
 }
 
-std::unordered_map<std::string, std::string> daedalus::entropia::parser::identifiers = std::unordered_map<std::string, std::string>();
+thread_local std::unordered_map<std::string, std::string> daedalus::entropia::parser::identifiers = std::unordered_map<std::string, std::string>();
+
+thread_local bool daedalus::entropia::parser::lazyScopes = false;
 
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::parse_identifier(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon) {
 	if(peek(tokens).type == "IDENTIFIER") {
@@ -248,7 +250,8 @@ void daedalus::entropia::parser::check_assignation_type(std::shared_ptr<daedalus
     std::shared_ptr<daedalus::core::ast::Expression> typeExpression = (
 	    expression->type() == "LoopExpression" ||
 	    expression->type() == "WhileExpression" ||
-	    expression->type() == "ForExpression"
+	    expression->type() == "ForExpression" ||
+	    expression->type() == "ParallelForExpression"
 	) ?
 	    std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression)->get_or_expression()->get_value() :
 		expression->type() == "ConditionnalStructure" ?
@@ -406,7 +409,11 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 	}
 	(void)eat(tokens);
 
+	// The assigned bodies are parsed right away, their type being checked against the identifier
+	bool lazyScopes = daedalus::entropia::parser::lazyScopes;
+	daedalus::entropia::parser::lazyScopes = false;
 	std::shared_ptr<daedalus::core::ast::Expression> expression = daedalus::entropia::parser::parse_binary_expression(parser, tokens, false)->get_constexpr();
+	daedalus::entropia::parser::lazyScopes = lazyScopes;
 
 	if(auto containerExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ContainerExpression>(expression)) {
 		if(auto source_identifier = std::dynamic_pointer_cast<daedalus::entropia::ast::ContainerExpression>(expression)->get_inner_identifier()) {
@@ -457,7 +464,11 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 
 	(void)expect(tokens, "ASSIGN", std::runtime_error("Expected assignment symbol"));
 
+	// The assigned bodies are parsed right away, their type being checked against the identifier
+	bool lazyScopes = daedalus::entropia::parser::lazyScopes;
+	daedalus::entropia::parser::lazyScopes = false;
 	std::shared_ptr<daedalus::core::ast::Expression> expression = daedalus::core::parser::parse_expression(parser, tokens, false)->get_constexpr();
+	daedalus::entropia::parser::lazyScopes = lazyScopes;
 
 	daedalus::entropia::parser::identifiers[identifier->get_name()] = type;
 
@@ -479,6 +490,71 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 	return std::make_shared<daedalus::entropia::ast::DeclarationExpression>(identifier, expression, type, isMutable);
 }
 
+std::vector<std::shared_ptr<daedalus::core::ast::Expression>> daedalus::entropia::parser::parse_body(daedalus::core::parser::Parser &parser, std::vector<daedalus::core::lexer::Token> &tokens) {
+	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+
+	if(!daedalus::entropia::parser::lazyScopes) {
+		// TODO Add max iteration to prevent unclosed body
+		while(peek(tokens).type != "CLOSE_BRACE") {
+		    body.push_back(daedalus::core::parser::parse_expression(parser, tokens, true));
+		}
+		return body;
+	}
+
+	// Only match the braces, the statements are parsed on the first evaluation
+	auto bodyTokens = std::vector<daedalus::core::lexer::Token>();
+	size_t depth = 0;
+	while(depth > 0 || peek(tokens).type != "CLOSE_BRACE") {
+		DAE_ASSERT_TRUE(
+		    tokens.size() > 0,
+			std::runtime_error("Expected close brace after body")
+		)
+		if(peek(tokens).type == "OPEN_BRACE") {
+			depth++;
+		} else if(peek(tokens).type == "CLOSE_BRACE") {
+			depth--;
+		}
+		bodyTokens.push_back(eat(tokens));
+	}
+
+	if(bodyTokens.size() > 0) {
+		body.push_back(std::make_shared<daedalus::entropia::ast::LazyScope>(bodyTokens, &parser, daedalus::entropia::parser::identifiers));
+	}
+
+	return body;
+}
+
+void daedalus::entropia::parser::parse_lazy_scope(std::shared_ptr<daedalus::entropia::ast::LazyScope> lazyScope) {
+	if(lazyScope->is_parsed()) {
+		return;
+	}
+
+	std::vector<daedalus::core::lexer::Token> tokens = lazyScope->get_tokens();
+	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+
+	// Parsed with the identifier types of where it was deferred, not of the end of the program
+	std::unordered_map<std::string, std::string> identifiers = lazyScope->get_identifiers();
+	std::swap(identifiers, daedalus::entropia::parser::identifiers);
+	try {
+		while(tokens.size() > 0) {
+		    body.push_back(daedalus::core::parser::parse_expression(*lazyScope->get_parser(), tokens, true));
+		}
+	} catch(...) {
+		std::swap(identifiers, daedalus::entropia::parser::identifiers);
+		throw;
+	}
+	std::swap(identifiers, daedalus::entropia::parser::identifiers);
+
+	// Same passes as the eagerly parsed program, checked as if the body hadn't been deferred
+	daedalus::entropia::checker::TypeChecker(lazyScope->get_deferred_check()).check(
+	    std::make_shared<daedalus::core::ast::Scope>(body)
+	);
+
+	// Its own scope, its hidden declarations can shadow the ones of the enclosing scopes
+	auto names = daedalus::entropia::optimizer::TemporaryNames();
+	lazyScope->set_body(daedalus::entropia::optimizer::optimize_body(body, names));
+}
+
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::parse_or_expression(daedalus::core::parser::Parser &parser, std::vector<daedalus::core::lexer::Token> &tokens, bool needsSemicolon) {
     (void)expect(tokens, "OR", std::runtime_error("Expected or expression"));
 
@@ -503,12 +579,7 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 
 	(void)expect(tokens, "OPEN_BRACE", std::runtime_error("Expected open brace before loop body"));
 
-	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
-
-	// TODO Add max iteration to prevent unclosed loop
-	while(peek(tokens).type != "CLOSE_BRACE") {
-	    body.push_back(daedalus::core::parser::parse_expression(parser, tokens, true));
-	}
+	auto body = daedalus::entropia::parser::parse_body(parser, tokens);
 	(void)eat(tokens);
 
 	auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(
@@ -534,12 +605,7 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 	(void)expect(tokens, "CLOSE_PAREN", std::runtime_error("Expected close parenthesis after while condition"));
 	(void)expect(tokens, "OPEN_BRACE", std::runtime_error("Expected open brace before while body"));
 
-	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
-
-	// TODO Add max iteration to prevent unclosed loop
-	while(peek(tokens).type != "CLOSE_BRACE") {
-	   body.push_back(daedalus::core::parser::parse_expression(parser, tokens, true));
-	}
+	auto body = daedalus::entropia::parser::parse_body(parser, tokens);
 	(void)eat(tokens);
 
 	auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(
@@ -553,7 +619,39 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 	);
 }
 
+std::vector<daedalus::entropia::ast::Reduction> daedalus::entropia::parser::parse_reductions(std::vector<daedalus::core::lexer::Token> &tokens) {
+	auto reductions = std::vector<daedalus::entropia::ast::Reduction>();
+	// reduce is only a keyword after the parentheses of a par for
+	if(peek(tokens).type != "IDENTIFIER" || peek(tokens).value != "reduce") {
+		return reductions;
+	}
+	(void)eat(tokens);
+
+	(void)expect(tokens, "OPEN_PAREN", std::runtime_error("Expected open parenthesis before reductions"));
+	do {
+		if(!reductions.empty()) {
+			(void)eat(tokens);
+		}
+		std::string name = expect(tokens, "IDENTIFIER", std::runtime_error("Expected reduction identifier")).value;
+		(void)expect(tokens, "COLON", std::runtime_error("Expected colon after reduction identifier"));
+		std::string operator_symbol = expect(tokens, "BINARY_OPERATOR", std::runtime_error("Expected reduction operator")).value;
+		DAE_ASSERT_TRUE(
+			operator_symbol == "+" || operator_symbol == "*" || operator_symbol == "&&" || operator_symbol == "||",
+			std::runtime_error("Invalid reduction operator " + operator_symbol + " (expected +, *, && or ||)")
+		)
+		reductions.push_back({ name, operator_symbol });
+	} while(peek(tokens).type == "COMMA");
+	(void)expect(tokens, "CLOSE_PAREN", std::runtime_error("Expected close parenthesis after reductions"));
+
+	return reductions;
+}
+
 std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::parse_for_expression(daedalus::core::parser::Parser &parser, std::vector<daedalus::core::lexer::Token> &tokens, bool needsSemicolon) {
+	// par is only a keyword before for, it stays a valid identifier
+	bool isParallel = tokens.size() > 1 && peek(tokens).type == "IDENTIFIER" && peek(tokens).value == "par" && tokens.at(1).type == "FOR";
+	if(isParallel) {
+		(void)eat(tokens);
+	}
     if(peek(tokens).type != "FOR") {
 		return parse_while_expression(parser, tokens, needsSemicolon);
 	}
@@ -570,20 +668,35 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 	std::shared_ptr<daedalus::core::ast::Expression> update_expression = daedalus::core::parser::parse_expression(parser, tokens, false);
 
 	(void)expect(tokens, "CLOSE_PAREN", std::runtime_error("Expected close parenthesis after for update expression"));
-	(void)expect(tokens, "OPEN_BRACE", std::runtime_error("Expected open brace before for body"));
 
-	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+	auto reductions = isParallel ?
+		daedalus::entropia::parser::parse_reductions(tokens) :
+		std::vector<daedalus::entropia::ast::Reduction>();
 
-	// TODO Add max iteration to prevent unclosed loop
-	while(peek(tokens).type != "CLOSE_BRACE") {
-	   body.push_back(daedalus::core::parser::parse_expression(parser, tokens, true));
-	}
+	(void)expect(tokens, "OPEN_BRACE", std::runtime_error("Expected open brace before for body"));
+
+	// The body of a par for is checked and shared by several threads, it is parsed right away
+	bool lazyScopes = daedalus::entropia::parser::lazyScopes;
+	daedalus::entropia::parser::lazyScopes = lazyScopes && !isParallel;
+	auto body = daedalus::entropia::parser::parse_body(parser, tokens);
+	daedalus::entropia::parser::lazyScopes = lazyScopes;
 	(void)eat(tokens);
 
 	auto orExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(
 	    parse_or_expression(parser, tokens, needsSemicolon)
 	);
 
+	if(isParallel) {
+		return std::make_shared<daedalus::entropia::ast::ParallelForExpression>(
+		    body,
+			initial_expression,
+			condition,
+			update_expression,
+			reductions,
+			orExpression
+		);
+	}
+
 	return std::make_shared<daedalus::entropia::ast::ForExpression>(
 	    body,
 		initial_expression,
@@ -641,12 +754,7 @@ std::shared_ptr<daedalus::core::ast::Expression> daedalus::entropia::parser::par
 
     (void)expect(tokens, "OPEN_BRACE", std::runtime_error("Expected open brace before conditionnal body"));
 
-    auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
-
-    // TODO Add max iteration to prevent unclosed body
-    while(peek(tokens).type != "CLOSE_BRACE") {
-        body.push_back(daedalus::core::parser::parse_expression(parser, tokens, true));
-	}
+    auto body = daedalus::entropia::parser::parse_body(parser, tokens);
 
 	DAE_ASSERT_TRUE(
 	    body.size() > 0,
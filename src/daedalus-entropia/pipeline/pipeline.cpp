@@ -0,0 +1,161 @@
+#include <daedalus/Entropia/pipeline/pipeline.hpp>
+
+#include <exception>
+
+std::vector<std::string> daedalus::entropia::pipeline::split_source(std::string_view src, size_t segmentSize) {
+	auto segments = std::vector<std::string>();
+	size_t start = 0;
+	// Quote of the char / str literal being read
+	char quote = '\0';
+
+	for(size_t i = 0; i < src.size(); i++) {
+		char c = src.at(i);
+		if(quote != '\0') {
+			if(c == '\\') {
+				i++;
+			} else if(c == quote) {
+				quote = '\0';
+			}
+			continue;
+		}
+		if(c == '"' || c == '\'') {
+			quote = c;
+			continue;
+		}
+		if(c == '\n' && i + 1 - start >= segmentSize) {
+			segments.push_back(std::string(src.substr(start, i + 1 - start)));
+			start = i + 1;
+		}
+	}
+
+	if(start < src.size()) {
+		segments.push_back(std::string(src.substr(start)));
+	}
+	return segments;
+}
+
+bool daedalus::entropia::pipeline::is_statement_end(const daedalus::core::lexer::Token& token, size_t& depth) {
+	if(token.type == "OPEN_PAREN" || token.type == "OPEN_BRACE") {
+		depth++;
+	} else if((token.type == "CLOSE_PAREN" || token.type == "CLOSE_BRACE") && depth > 0) {
+		depth--;
+	}
+	return depth == 0 && token.type == "SEMICOLON";
+}
+
+std::shared_ptr<daedalus::core::ast::Scope> daedalus::entropia::pipeline::run_pipelined(
+	daedalus::core::Daedalus& daedalusConfig,
+	std::string_view src,
+	std::function<void(const daedalus::entropia::interpreter::LazyResult&)> onResult
+) {
+	auto tokens = daedalus::entropia::pipeline::BoundedQueue<daedalus::core::lexer::Token>(daedalus::entropia::pipeline::TOKEN_QUEUE_CAPACITY);
+	auto statements = daedalus::entropia::pipeline::BoundedQueue<std::shared_ptr<daedalus::core::ast::Expression>>(daedalus::entropia::pipeline::STATEMENT_QUEUE_CAPACITY);
+	// Each one written by its stage before closing its queue
+	std::exception_ptr lexerError = nullptr;
+	std::exception_ptr parserError = nullptr;
+
+	// * LEXER
+
+	std::thread lexer = std::thread([&daedalusConfig, &src, &tokens, &lexerError]() {
+		try {
+			bool isCancelled = false;
+			for(const std::string& segment : daedalus::entropia::pipeline::split_source(src, daedalus::entropia::pipeline::LEXER_SEGMENT_SIZE)) {
+				auto segmentTokens = std::vector<daedalus::core::lexer::Token>();
+				daedalus::core::lexer::lex(daedalusConfig.lexer, segmentTokens, segment);
+				for(daedalus::core::lexer::Token& token : segmentTokens) {
+					isCancelled = isCancelled || !tokens.push(std::move(token));
+				}
+				if(isCancelled) {
+					break;
+				}
+			}
+		} catch(...) {
+			lexerError = std::current_exception();
+		}
+		tokens.close();
+	});
+
+	// * PARSER, CHECKER, OPTIMIZER
+
+	std::thread parser = std::thread([&daedalusConfig, &tokens, &statements, &lexerError, &parserError]() {
+		try {
+			daedalus::entropia::checker::TypeChecker checker = daedalus::entropia::checker::TypeChecker();
+
+			auto names = daedalus::entropia::optimizer::TemporaryNames();
+
+			auto statementTokens = std::vector<daedalus::core::lexer::Token>();
+			auto parse_statements = [&daedalusConfig, &checker, &names, &statements, &statementTokens]() {
+				while(!statementTokens.empty()) {
+					std::shared_ptr<daedalus::core::ast::Expression> expression = daedalus::core::parser::parse_expression(daedalusConfig.parser, statementTokens, true);
+					checker.check_statement(expression);
+					for(std::shared_ptr<daedalus::core::ast::Expression> statement : daedalus::entropia::optimizer::optimize_body({ expression }, names)) {
+						if(!statements.push(statement)) {
+							return false;
+						}
+					}
+				}
+				return true;
+			};
+
+			size_t depth = 0;
+			bool isRunning = true;
+			daedalus::core::lexer::Token token;
+			while(isRunning && tokens.pop(token)) {
+				bool isStatementEnd = daedalus::entropia::pipeline::is_statement_end(token, depth);
+				statementTokens.push_back(std::move(token));
+				if(isStatementEnd) {
+					isRunning = parse_statements();
+				}
+			}
+
+			if(isRunning) {
+				if(lexerError != nullptr) {
+					std::rethrow_exception(lexerError);
+				}
+				(void)parse_statements();
+			}
+		} catch(...) {
+			parserError = std::current_exception();
+		}
+		// Stops the lexer when the parser stopped first
+		tokens.cancel();
+		statements.close();
+	});
+
+	// * INTERPRETER
+
+	auto body = std::vector<std::shared_ptr<daedalus::core::ast::Expression>>();
+	std::exception_ptr interpreterError = nullptr;
+	try {
+		auto env = std::make_shared<daedalus::core::env::Environment>(
+			daedalusConfig.interpreter.envValuesProperties,
+			daedalusConfig.interpreter.validationRules,
+			nullptr
+		);
+
+		std::shared_ptr<daedalus::core::ast::Expression> statement = nullptr;
+		while(statements.pop(statement)) {
+			body.push_back(statement);
+			std::shared_ptr<daedalus::core::values::RuntimeValue> value = daedalus::core::interpreter::evaluate_statement(daedalusConfig.interpreter, statement, env).value;
+			if(!daedalus::entropia::ast::is_hidden(statement)) {
+				onResult({ statement, value });
+			}
+		}
+	} catch(...) {
+		interpreterError = std::current_exception();
+	}
+
+	statements.cancel();
+	tokens.cancel();
+	lexer.join();
+	parser.join();
+
+	if(interpreterError != nullptr) {
+		std::rethrow_exception(interpreterError);
+	}
+	if(parserError != nullptr) {
+		std::rethrow_exception(parserError);
+	}
+
+	return std::make_shared<daedalus::core::ast::Scope>(body);
+}
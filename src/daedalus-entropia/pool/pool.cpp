@@ -0,0 +1,80 @@
+#include <daedalus/Entropia/pool/pool.hpp>
+
+#include <algorithm>
+
+size_t daedalus::entropia::pool::threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+static thread_local bool isWorkerThread = false;
+
+bool daedalus::entropia::pool::is_worker_thread() {
+	return isWorkerThread;
+}
+
+#pragma region WorkStealingPool
+
+daedalus::entropia::pool::WorkStealingPool::WorkStealingPool(size_t threadCount, size_t jobCount, std::function<void(size_t)> job) :
+	job(job),
+	queues(),
+	threads()
+{
+	threadCount = std::max<size_t>(1, std::min(threadCount, jobCount));
+	if(jobCount == 0) {
+		return;
+	}
+
+	for(size_t worker = 0; worker < threadCount; worker++) {
+		auto queue = std::make_unique<WorkerQueue>();
+		for(size_t i = worker * jobCount / threadCount; i < (worker + 1) * jobCount / threadCount; i++) {
+			queue->jobs.push_back(i);
+		}
+		this->queues.push_back(std::move(queue));
+	}
+
+	// Every queue is filled before a worker can steal from it
+	for(size_t worker = 0; worker < threadCount; worker++) {
+		this->threads.emplace_back(&daedalus::entropia::pool::WorkStealingPool::work, this, worker);
+	}
+}
+
+daedalus::entropia::pool::WorkStealingPool::~WorkStealingPool() {
+	for(std::thread& thread : this->threads) {
+		thread.join();
+	}
+}
+
+void daedalus::entropia::pool::WorkStealingPool::work(size_t worker) {
+	isWorkerThread = true;
+	size_t job = 0;
+	// No job is added once started, a worker is done when every queue is empty
+	while(this->pop(worker, job) || this->steal(worker, job)) {
+		this->job(job);
+	}
+}
+
+bool daedalus::entropia::pool::WorkStealingPool::pop(size_t worker, size_t& job) {
+	WorkerQueue& queue = *this->queues.at(worker);
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if(queue.jobs.empty()) {
+		return false;
+	}
+	job = queue.jobs.front();
+	queue.jobs.pop_front();
+	return true;
+}
+
+bool daedalus::entropia::pool::WorkStealingPool::steal(size_t thief, size_t& job) {
+	for(size_t i = 1; i < this->queues.size(); i++) {
+		WorkerQueue& queue = *this->queues.at((thief + i) % this->queues.size());
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if(!queue.jobs.empty()) {
+			// The last jobs of the victim, the furthest from being printed
+			job = queue.jobs.back();
+			queue.jobs.pop_back();
+			return true;
+		}
+	}
+	return false;
+}
+
+#pragma endregion
+
@@ -0,0 +1,113 @@
+#include <daedalus/Entropia/program/program.hpp>
+
+daedalus::core::Daedalus& daedalus::entropia::program::get_daedalus() {
+	static daedalus::core::Daedalus daedalusConfig = daedalus::core::setup_daedalus(
+		&setup_lexer,
+		&setup_parser,
+		&setup_interpreter
+	);
+	return daedalusConfig;
+}
+
+bool daedalus::entropia::program::is_value_of_type(std::shared_ptr<daedalus::core::values::RuntimeValue> value, std::string type) {
+	if(value == nullptr) {
+		return false;
+	}
+	if(daedalus::entropia::checker::is_number_type(type)) {
+		return value->type() == "NumberValue";
+	}
+	if(type == "bool") {
+		return value->type() == "BooleanValue";
+	}
+	if(type == "char") {
+		return value->type() == "CharValue";
+	}
+	if(type == "str") {
+		return value->type() == "StrValue";
+	}
+	return false;
+}
+
+#pragma region CompiledProgram
+
+daedalus::entropia::program::CompiledProgram::CompiledProgram(std::string src, std::unordered_map<std::string, std::string> inputTypes) :
+	program(std::make_shared<daedalus::core::ast::Scope>()),
+	inputTypes(inputTypes)
+{
+	daedalus::core::Daedalus& daedalusConfig = daedalus::entropia::program::get_daedalus();
+
+	std::vector<daedalus::core::lexer::Token> tokens;
+	daedalus::core::lexer::lex(daedalusConfig.lexer, tokens, src);
+
+	// A lazy scope is parsed on its first run, the program must not change once compiled
+	bool lazyScopes = daedalus::entropia::parser::lazyScopes;
+	daedalus::entropia::parser::lazyScopes = false;
+	daedalus::entropia::parser::identifiers = inputTypes;
+	try {
+		daedalus::core::parser::parse(daedalusConfig.parser, this->program, tokens);
+	} catch(...) {
+		daedalus::entropia::parser::lazyScopes = lazyScopes;
+		throw;
+	}
+	daedalus::entropia::parser::lazyScopes = lazyScopes;
+
+	daedalus::entropia::checker::TypeChecker(inputTypes).check(this->program);
+	this->program = daedalus::entropia::optimizer::optimize(this->program);
+}
+
+daedalus::entropia::program::CompiledProgram::CompiledProgram(std::shared_ptr<daedalus::core::ast::Scope> program) :
+	program(program),
+	inputTypes()
+{}
+
+std::shared_ptr<daedalus::core::ast::Scope> daedalus::entropia::program::CompiledProgram::get_program() const {
+	return this->program;
+}
+
+const std::unordered_map<std::string, std::string>& daedalus::entropia::program::CompiledProgram::get_input_types() const {
+	return this->inputTypes;
+}
+
+#pragma endregion
+
+#pragma region ExecutionContext
+
+daedalus::entropia::program::ExecutionContext::ExecutionContext(std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program) :
+	program(program),
+	inputs()
+{}
+
+void daedalus::entropia::program::ExecutionContext::set_input(std::string name, std::shared_ptr<daedalus::core::values::RuntimeValue> value) {
+	auto inputType = this->program->get_input_types().find(name);
+	DAE_ASSERT_TRUE(
+		inputType != this->program->get_input_types().end(),
+		std::runtime_error("Unknown input \"" + name + "\"")
+	)
+	DAE_ASSERT_TRUE(
+		daedalus::entropia::program::is_value_of_type(value, inputType->second),
+		std::runtime_error("Invalid value for input \"" + name + "\" of type " + inputType->second)
+	)
+	this->inputs[name] = value;
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::program::ExecutionContext::run(std::vector<daedalus::entropia::interpreter::LazyResult>* results) {
+	daedalus::core::interpreter::Interpreter& interpreter = daedalus::entropia::program::get_daedalus().interpreter;
+
+	auto inputEnv = std::make_shared<daedalus::core::env::Environment>(
+		interpreter.envValuesProperties,
+		interpreter.validationRules,
+		nullptr
+	);
+	for(const auto& [name, type] : this->program->get_input_types()) {
+		auto input = this->inputs.find(name);
+		DAE_ASSERT_TRUE(
+			input != this->inputs.end(),
+			std::runtime_error("Missing input \"" + name + "\"")
+		)
+		inputEnv->init_value(name, input->second, { { "isMutable", "false" } });
+	}
+
+	return daedalus::entropia::interpreter::interpret(interpreter, this->program->get_program(), results, inputEnv);
+}
+
+#pragma endregion
@@ -0,0 +1,345 @@
+#include <daedalus/Entropia/record/record.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+std::vector<daedalus::entropia::record::Field> daedalus::entropia::record::parse_fields(std::string description) {
+	auto fields = std::vector<daedalus::entropia::record::Field>();
+	size_t start = 0;
+	while(start < description.size()) {
+		size_t end = description.find(',', start);
+		if(end == std::string::npos) {
+			end = description.size();
+		}
+		std::string field = description.substr(start, end - start);
+		size_t colon = field.find(':');
+		DAE_ASSERT_TRUE(
+			colon != std::string::npos && colon > 0,
+			std::runtime_error("Invalid field \"" + field + "\", expected <name>:<type>")
+		)
+
+		std::string name = field.substr(0, colon);
+		std::string type = field.substr(colon + 1);
+		DAE_ASSERT_TRUE(
+			type != daedalus::entropia::checker::NUMBER_TYPE && (daedalus::entropia::checker::is_number_type(type) || type == "bool" || type == "char" || type == "str"),
+			std::runtime_error("Invalid type \"" + type + "\" for field \"" + name + "\"")
+		)
+		DAE_ASSERT_TRUE(
+			name != daedalus::entropia::record::RECORD_NAME,
+			std::runtime_error("Field \"" + name + "\" already declared as the whole record")
+		)
+		for(const daedalus::entropia::record::Field& other : fields) {
+			DAE_ASSERT_TRUE(
+				other.name != name,
+				std::runtime_error("Field \"" + name + "\" declared twice")
+			)
+		}
+
+		fields.push_back({ name, type });
+		start = end + 1;
+	}
+	return fields;
+}
+
+void daedalus::entropia::record::split_fields(std::string_view record, char separator, size_t count, std::vector<std::string_view>& fieldTexts) {
+	fieldTexts.clear();
+	size_t start = 0;
+	while(fieldTexts.size() < count && start <= record.size()) {
+		size_t end = record.find(separator, start);
+		if(end == std::string_view::npos) {
+			end = record.size();
+		}
+		fieldTexts.push_back(record.substr(start, end - start));
+		start = end + 1;
+	}
+	// The separators left after the last field start the extra ones
+	size_t fieldCount = start <= record.size() ?
+		fieldTexts.size() + 1 + std::count(record.begin() + start, record.end(), separator) :
+		fieldTexts.size();
+	DAE_ASSERT_TRUE(
+		fieldCount == count,
+		std::runtime_error("Expected " + std::to_string(count) + " fields, got " + std::to_string(fieldCount))
+	)
+}
+
+// Same ranges as the literals checked by the parser
+static bool is_in_range(double value, const std::string& type) {
+	if(type == "i8") {
+		return value >= _I8_MIN && value <= _I8_MAX;
+	}
+	if(type == "i16") {
+		return value >= _I16_MIN && value <= _I16_MAX;
+	}
+	if(type == "i32") {
+		return value >= _I32_MIN && value <= _I32_MAX;
+	}
+	if(type == "i64") {
+		return value >= _I64_MIN && value <= _I64_MAX;
+	}
+	if(type == "u8") {
+		return value >= 0 && value <= _UI8_MAX;
+	}
+	if(type == "u16") {
+		return value >= 0 && value <= _UI16_MAX;
+	}
+	if(type == "u32") {
+		return value >= 0 && value <= _UI32_MAX;
+	}
+	if(type == "u64") {
+		return value >= 0 && value <= _UI64_MAX;
+	}
+	return true;
+}
+
+double daedalus::entropia::record::parse_number(std::string_view text, const std::string& type) {
+	double value = 0;
+	std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+	DAE_ASSERT_TRUE(
+		result.ec == std::errc() && result.ptr == text.data() + text.size(),
+		std::runtime_error("Invalid " + type + " \"" + std::string(text) + "\"")
+	)
+	bool isInteger = type.at(0) == 'i' || type.at(0) == 'u';
+	DAE_ASSERT_TRUE(
+		!isInteger || (std::trunc(value) == value && is_in_range(value, type)),
+		std::runtime_error("Invalid " + type + " \"" + std::string(text) + "\"")
+	)
+	return value;
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::record::parse_field(std::string_view text, const std::string& type) {
+	if(type == "str") {
+		return daedalus::entropia::region::make_value<daedalus::entropia::values::StrValue>(std::string(text));
+	}
+	if(type == "char") {
+		DAE_ASSERT_TRUE(
+			text.size() == 1,
+			std::runtime_error("Invalid char \"" + std::string(text) + "\"")
+		)
+		return daedalus::entropia::values::get_char(text.at(0));
+	}
+	if(type == "bool") {
+		DAE_ASSERT_TRUE(
+			text == "true" || text == "false",
+			std::runtime_error("Invalid bool \"" + std::string(text) + "\"")
+		)
+		return daedalus::entropia::values::get_boolean(text == "true");
+	}
+
+	return daedalus::entropia::values::get_number(daedalus::entropia::record::parse_number(text, type));
+}
+
+#pragma region LineReader
+
+daedalus::entropia::record::LineReader::LineReader(std::istream& input) :
+	input(input),
+	buffer(daedalus::entropia::record::READ_BUFFER_SIZE),
+	start(0),
+	end(0),
+	isEnd(false)
+{}
+
+bool daedalus::entropia::record::LineReader::next(std::string_view& line) {
+	while(true) {
+		const char* begin = this->buffer.data() + this->start;
+		auto newline = static_cast<const char*>(std::memchr(begin, '\n', this->end - this->start));
+
+		if(newline != nullptr || this->isEnd) {
+			if(newline == nullptr && this->start == this->end) {
+				return false;
+			}
+			size_t length = newline != nullptr ? newline - begin : this->end - this->start;
+			this->start += newline != nullptr ? length + 1 : length;
+			if(length > 0 && begin[length - 1] == '\r') {
+				length--;
+			}
+			line = std::string_view(begin, length);
+			return true;
+		}
+
+		// The unfinished line is moved to the front, the buffer grows when it's full of it
+		size_t pending = this->end - this->start;
+		std::memmove(this->buffer.data(), begin, pending);
+		this->start = 0;
+		this->end = pending;
+		if(this->end == this->buffer.size()) {
+			this->buffer.resize(this->buffer.size() * 2);
+		}
+
+		this->input.read(this->buffer.data() + this->end, this->buffer.size() - this->end);
+		this->end += this->input.gcount();
+		this->isEnd = !this->input;
+	}
+}
+
+#pragma endregion
+
+#pragma region RecordRunner
+
+daedalus::entropia::record::RecordRunner::RecordRunner(std::string src, std::vector<daedalus::entropia::record::Field> fields, char separator, bool isColumnar) :
+	program(nullptr),
+	columnarProgram(nullptr),
+	fields(fields),
+	separator(separator),
+	isRecordRead(false),
+	inputEnv(nullptr),
+	fieldTexts()
+{
+	daedalus::core::Daedalus& daedalusConfig = daedalus::entropia::program::get_daedalus();
+
+	// The whole record is only copied into a value for the programs reading it
+	std::vector<daedalus::core::lexer::Token> tokens;
+	daedalus::core::lexer::lex(daedalusConfig.lexer, tokens, src);
+	for(const daedalus::core::lexer::Token& token : tokens) {
+		this->isRecordRead = this->isRecordRead || (token.type == "IDENTIFIER" && token.value == daedalus::entropia::record::RECORD_NAME);
+	}
+
+	auto inputTypes = std::unordered_map<std::string, std::string>();
+	for(const daedalus::entropia::record::Field& field : fields) {
+		inputTypes[field.name] = field.type;
+	}
+	if(this->isRecordRead) {
+		inputTypes[daedalus::entropia::record::RECORD_NAME] = "str";
+	}
+	this->program = std::make_shared<const daedalus::entropia::program::CompiledProgram>(src, inputTypes);
+
+	if(isColumnar) {
+		try {
+			this->columnarProgram = std::make_shared<const daedalus::entropia::columnar::ColumnarProgram>(this->program);
+		} catch(const std::exception& error) {
+			// Still run, record by record
+			DAE_DEBUG_LOG(std::string("COLUMNAR ") + error.what())
+		}
+	}
+
+	this->inputEnv = std::make_shared<daedalus::core::env::Environment>(
+		daedalusConfig.interpreter.envValuesProperties,
+		daedalusConfig.interpreter.validationRules,
+		nullptr
+	);
+	// Mutable to be rebound by the runner, the checker already rejects the assignments of the program to them
+	for(const auto& [name, type] : inputTypes) {
+		this->inputEnv->init_value(name, daedalus::entropia::values::get_null(), { { "isMutable", "true" } });
+	}
+}
+
+std::shared_ptr<daedalus::core::values::RuntimeValue> daedalus::entropia::record::RecordRunner::run(std::string_view record) {
+	daedalus::entropia::record::split_fields(record, this->separator, this->fields.size(), this->fieldTexts);
+
+	for(size_t i = 0; i < this->fields.size(); i++) {
+		this->inputEnv->set_value(this->fields.at(i).name, daedalus::entropia::record::parse_field(this->fieldTexts.at(i), this->fields.at(i).type));
+	}
+	if(this->isRecordRead) {
+		this->inputEnv->set_value(daedalus::entropia::record::RECORD_NAME, daedalus::entropia::record::parse_field(record, "str"));
+	}
+
+	return daedalus::entropia::interpreter::interpret(
+		daedalus::entropia::program::get_daedalus().interpreter,
+		this->program->get_program(),
+		nullptr,
+		this->inputEnv
+	);
+}
+
+std::shared_ptr<const daedalus::entropia::columnar::ColumnarProgram> daedalus::entropia::record::RecordRunner::get_columnar_program() const {
+	return this->columnarProgram;
+}
+
+void daedalus::entropia::record::RecordRunner::add_row(daedalus::entropia::columnar::Batch& batch, std::string_view record) {
+	size_t row = daedalus::entropia::columnar::add_row(batch);
+	try {
+		daedalus::entropia::record::split_fields(record, this->separator, this->fields.size(), this->fieldTexts);
+		for(size_t i = 0; i < this->fields.size(); i++) {
+			const daedalus::entropia::record::Field& field = this->fields.at(i);
+			std::string_view text = this->fieldTexts.at(i);
+
+			// The str fields have no column, and can't be invalid
+			auto input = batch.inputs.find(field.name);
+			if(input == batch.inputs.end()) {
+				continue;
+			}
+			daedalus::entropia::columnar::Column& column = input->second;
+			if(column.type == daedalus::entropia::columnar::ColumnType::NUMBER) {
+				column.numbers.at(row) = daedalus::entropia::record::parse_number(text, field.type);
+			} else if(column.type == daedalus::entropia::columnar::ColumnType::BOOLEAN) {
+				column.booleans.at(row) = daedalus::entropia::record::parse_field(text, field.type)->IsTrue();
+			} else {
+				column.chars.at(row) = std::static_pointer_cast<daedalus::entropia::values::CharValue>(daedalus::entropia::record::parse_field(text, field.type))->get();
+			}
+		}
+	} catch(const std::exception& error) {
+		daedalus::entropia::columnar::fail_row(batch, row, error.what());
+	}
+}
+
+#pragma endregion
+
+size_t daedalus::entropia::record::run_records(daedalus::entropia::record::RecordRunner& runner, std::istream& input, std::ostream& output, std::ostream& errors) {
+	daedalus::entropia::record::LineReader reader = daedalus::entropia::record::LineReader(input);
+	// Written by blocks, the errors right away
+	std::string buffer = "";
+	buffer.reserve(daedalus::entropia::record::OUTPUT_BUFFER_SIZE);
+
+	// The values of a record are released together, unless one is still bound
+	daedalus::entropia::region::Region region;
+	size_t recordNumber = 0;
+	size_t failures = 0;
+	std::string_view line;
+
+	std::shared_ptr<const daedalus::entropia::columnar::ColumnarProgram> columnarProgram = runner.get_columnar_program();
+	if(columnarProgram != nullptr) {
+		daedalus::entropia::columnar::Batch batch = columnarProgram->make_batch();
+		auto run_batch = [&columnarProgram, &batch, &region, &recordNumber, &failures, &buffer, &errors]() {
+			region.next_iteration();
+			daedalus::entropia::columnar::Column values = columnarProgram->run(batch);
+			for(size_t row = 0; row < batch.size; row++) {
+				recordNumber++;
+				if(batch.failed.at(row) != 0) {
+					errors << recordNumber << " !! " << batch.errors.at(row) << "\n";
+					failures++;
+					continue;
+				}
+				buffer += daedalus::entropia::columnar::get_row_value(values, row)->repr();
+				buffer += '\n';
+			}
+			daedalus::entropia::columnar::clear_batch(batch);
+		};
+
+		while(reader.next(line)) {
+			runner.add_row(batch, line);
+			if(batch.size == daedalus::entropia::columnar::BATCH_SIZE) {
+				run_batch();
+			}
+			if(buffer.size() >= daedalus::entropia::record::OUTPUT_BUFFER_SIZE) {
+				output.write(buffer.data(), buffer.size());
+				buffer.clear();
+			}
+		}
+		run_batch();
+	} else {
+		while(reader.next(line)) {
+			recordNumber++;
+			region.next_iteration();
+			try {
+				std::shared_ptr<daedalus::core::values::RuntimeValue> value = runner.run(line);
+				buffer += value != nullptr ? value->repr() : daedalus::entropia::values::get_null()->repr();
+				buffer += '\n';
+			} catch(const std::exception& error) {
+				errors << recordNumber << " !! " << error.what() << "\n";
+				failures++;
+			}
+
+			if(buffer.size() >= daedalus::entropia::record::OUTPUT_BUFFER_SIZE) {
+				output.write(buffer.data(), buffer.size());
+				buffer.clear();
+			}
+		}
+	}
+
+	output.write(buffer.data(), buffer.size());
+	output.flush();
+	errors.flush();
+	return failures;
+}
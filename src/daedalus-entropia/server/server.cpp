@@ -0,0 +1,368 @@
+#include <daedalus/Entropia/server/server.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+// A closed peer is reported as an error, never as SIGPIPE
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+static sockaddr_un get_address(const std::string& socketPath) {
+	sockaddr_un address = sockaddr_un();
+	DAE_ASSERT_TRUE(
+		!socketPath.empty() && socketPath.size() < sizeof(address.sun_path),
+		std::runtime_error("Invalid socket path " + socketPath)
+	)
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+	return address;
+}
+
+static int connect_to(const std::string& socketPath) {
+	sockaddr_un address = get_address(socketPath);
+	int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	DAE_ASSERT_TRUE(
+		fd >= 0,
+		std::runtime_error(std::string("Failed to create a socket: ") + std::strerror(errno))
+	)
+	if(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		::close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+static void write_all(int fd, const char* data, size_t size) {
+	while(size > 0) {
+		ssize_t written = ::send(fd, data, size, SEND_FLAGS);
+		if(written < 0 && errno == EINTR) {
+			continue;
+		}
+		DAE_ASSERT_TRUE(
+			written > 0,
+			std::runtime_error(std::string("Failed to write to the socket: ") + std::strerror(errno))
+		)
+		data += written;
+		size -= static_cast<size_t>(written);
+	}
+}
+
+// Returns false when the connection is closed before the first byte
+static bool read_all(int fd, char* data, size_t size) {
+	size_t total = 0;
+	while(total < size) {
+		ssize_t count = ::read(fd, data + total, size - total);
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		DAE_ASSERT_TRUE(
+			count >= 0,
+			std::runtime_error(std::string("Failed to read from the socket: ") + std::strerror(errno))
+		)
+		if(count == 0) {
+			DAE_ASSERT_TRUE(
+				total == 0,
+				std::runtime_error("Truncated message")
+			)
+			return false;
+		}
+		total += static_cast<size_t>(count);
+	}
+	return true;
+}
+
+static void send_message(int fd, daedalus::entropia::server::MessageKind kind, std::string_view payload) {
+	DAE_ASSERT_TRUE(
+		payload.size() <= daedalus::entropia::server::MAX_MESSAGE_SIZE,
+		std::runtime_error("Message of " + std::to_string(payload.size()) + " bytes over the limit of " + std::to_string(daedalus::entropia::server::MAX_MESSAGE_SIZE))
+	)
+	daedalus::entropia::server::MessageHeader header = daedalus::entropia::server::MessageHeader{ kind, static_cast<uint32_t>(payload.size()) };
+	write_all(fd, reinterpret_cast<const char*>(&header), sizeof(header));
+	write_all(fd, payload.data(), payload.size());
+}
+
+// Returns false when the connection is closed between two messages
+static bool receive_message(int fd, daedalus::entropia::server::MessageHeader& header, std::string& payload) {
+	if(!read_all(fd, reinterpret_cast<char*>(&header), sizeof(header))) {
+		return false;
+	}
+	DAE_ASSERT_TRUE(
+		header.size <= daedalus::entropia::server::MAX_MESSAGE_SIZE,
+		std::runtime_error("Message of " + std::to_string(header.size) + " bytes over the limit of " + std::to_string(daedalus::entropia::server::MAX_MESSAGE_SIZE))
+	)
+	payload.resize(header.size);
+	DAE_ASSERT_TRUE(
+		header.size == 0 || read_all(fd, payload.data(), payload.size()),
+		std::runtime_error("Truncated message")
+	)
+	return true;
+}
+
+static void serve_connection(int connection, daedalus::entropia::server::ProgramCache& programCache, bool recordResults, std::function<void()> stop) {
+	daedalus::entropia::server::MessageHeader header;
+	std::string payload;
+	while(receive_message(connection, header, payload)) {
+		if(header.kind == daedalus::entropia::server::MessageKind::STOP) {
+			send_message(connection, daedalus::entropia::server::MessageKind::VALUE, "");
+			stop();
+			return;
+		}
+		DAE_ASSERT_TRUE(
+			header.kind == daedalus::entropia::server::MessageKind::RUN,
+			std::runtime_error("Unexpected message " + std::to_string(static_cast<uint32_t>(header.kind)))
+		)
+
+		std::string value;
+		try {
+			value = daedalus::entropia::server::run_request(programCache, payload, recordResults);
+		} catch(const std::exception& error) {
+			send_message(connection, daedalus::entropia::server::MessageKind::FAILURE, error.what());
+			continue;
+		}
+		send_message(connection, daedalus::entropia::server::MessageKind::VALUE, value);
+	}
+}
+
+#endif
+
+#pragma region ProgramCache
+
+daedalus::entropia::server::ProgramCache::ProgramCache(size_t capacity) :
+	capacity(capacity),
+	mutex(),
+	entries(),
+	uses()
+{}
+
+std::shared_ptr<const daedalus::entropia::program::CompiledProgram> daedalus::entropia::server::ProgramCache::get_program(const std::string& src) {
+	uint64_t hash = daedalus::entropia::cache::hash_source(src);
+
+	// Compiled under the lock too, the parser configuration is shared by the compilations
+	std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(this->mutex);
+	auto entry = this->entries.find(hash);
+	if(entry != this->entries.end()) {
+		this->uses.erase(entry->second.use);
+		this->uses.push_front(hash);
+		entry->second.use = this->uses.begin();
+		if(entry->second.src == src) {
+			return entry->second.program;
+		}
+	}
+
+	auto program = std::make_shared<const daedalus::entropia::program::CompiledProgram>(src);
+	DAE_DEBUG_LOG("SERVER COMPILED " + std::to_string(hash))
+
+	if(entry != this->entries.end()) {
+		entry->second.src = src;
+		entry->second.program = program;
+		return program;
+	}
+
+	this->uses.push_front(hash);
+	this->entries[hash] = CacheEntry{ src, program, this->uses.begin() };
+	if(this->entries.size() > this->capacity) {
+		this->entries.erase(this->uses.back());
+		this->uses.pop_back();
+	}
+	return program;
+}
+
+size_t daedalus::entropia::server::ProgramCache::get_size() {
+	std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(this->mutex);
+	return this->entries.size();
+}
+
+#pragma endregion
+
+std::string daedalus::entropia::server::run_request(daedalus::entropia::server::ProgramCache& programCache, const std::string& src, bool recordResults) {
+	std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program = programCache.get_program(src);
+
+	auto lazyResults = std::vector<daedalus::entropia::interpreter::LazyResult>();
+	std::shared_ptr<daedalus::core::values::RuntimeValue> value = daedalus::entropia::program::ExecutionContext(program).run(
+		recordResults ? &lazyResults : nullptr
+	);
+
+	// Same layout as the batch outcomes
+	std::string text = "";
+	for(const daedalus::entropia::interpreter::LazyResult& lazyResult : lazyResults) {
+		daedalus::core::interpreter::RuntimeResult result = lazyResult.get();
+		text += "\t" + result.first + " -> " + result.second + "\n";
+	}
+	return text + (value != nullptr ? value->repr() : daedalus::entropia::values::get_null()->repr());
+}
+
+void daedalus::entropia::server::serve(std::string socketPath, size_t threadCount, bool recordResults) {
+#ifdef _WIN32
+	throw std::runtime_error("The daemon is only supported on POSIX systems");
+#else
+	// A socket file left by a stopped daemon is replaced, not the one of a running daemon
+	int running = connect_to(socketPath);
+	if(running >= 0) {
+		::close(running);
+		throw std::runtime_error("A daemon already listens on " + socketPath);
+	}
+	(void)::unlink(socketPath.c_str());
+
+	sockaddr_un address = get_address(socketPath);
+	int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	DAE_ASSERT_TRUE(
+		listener >= 0,
+		std::runtime_error(std::string("Failed to create a socket: ") + std::strerror(errno))
+	)
+	if(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, SOMAXCONN) != 0) {
+		std::string error = std::strerror(errno);
+		::close(listener);
+		throw std::runtime_error("Failed to listen on " + socketPath + ": " + error);
+	}
+
+	// Set up once, before the first request
+	(void)daedalus::entropia::program::get_daedalus();
+	daedalus::entropia::server::ProgramCache programCache = daedalus::entropia::server::ProgramCache();
+
+	threadCount = std::max<size_t>(1, threadCount);
+	std::atomic<bool> isStopped = std::atomic<bool>(false);
+	// Connections being served, registered under the lock only while not stopped
+	std::mutex connectionsMutex = std::mutex();
+	auto connections = std::unordered_set<int>();
+
+	auto stop = [&isStopped, &connectionsMutex, &connections, &socketPath, threadCount]() {
+		if(isStopped.exchange(true)) {
+			return;
+		}
+		// Each thread blocked on a read of an idle client sees its end, a request being run is still answered
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(connectionsMutex);
+			for(int connection : connections) {
+				(void)::shutdown(connection, SHUT_RD);
+			}
+		}
+		// Each thread blocked on accept is woken by a connection of its own
+		for(size_t i = 0; i < threadCount; i++) {
+			int wakeUp = connect_to(socketPath);
+			if(wakeUp >= 0) {
+				::close(wakeUp);
+			}
+		}
+	};
+
+	auto threads = std::vector<std::thread>();
+	for(size_t i = 0; i < threadCount; i++) {
+		threads.emplace_back([listener, &programCache, recordResults, &isStopped, &connectionsMutex, &connections, &stop]() {
+			while(!isStopped) {
+				int connection = ::accept(listener, nullptr, nullptr);
+				if(connection < 0) {
+					if(errno == EINTR || errno == ECONNABORTED) {
+						continue;
+					}
+					DAE_DEBUG_LOG(std::string("SERVER ") + std::strerror(errno))
+					return;
+				}
+				{
+					std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(connectionsMutex);
+					if(isStopped) {
+						::close(connection);
+						return;
+					}
+					connections.insert(connection);
+				}
+
+				// A broken connection only ends itself
+				try {
+					serve_connection(connection, programCache, recordResults, stop);
+				} catch(const std::exception& error) {
+					DAE_DEBUG_LOG(std::string("SERVER ") + error.what())
+				}
+
+				{
+					std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(connectionsMutex);
+					connections.erase(connection);
+				}
+				::close(connection);
+			}
+		});
+	}
+
+	for(std::thread& thread : threads) {
+		thread.join();
+	}
+	::close(listener);
+	(void)::unlink(socketPath.c_str());
+#endif
+}
+
+#pragma region Client
+
+daedalus::entropia::server::Client::Client(std::string socketPath) :
+	socket(-1)
+{
+#ifdef _WIN32
+	throw std::runtime_error("The daemon is only supported on POSIX systems");
+#else
+	this->socket = connect_to(socketPath);
+	DAE_ASSERT_TRUE(
+		this->socket >= 0,
+		std::runtime_error("No daemon listening on " + socketPath)
+	)
+#endif
+}
+
+daedalus::entropia::server::Client::~Client() {
+#ifndef _WIN32
+	if(this->socket >= 0) {
+		::close(this->socket);
+	}
+#endif
+}
+
+bool daedalus::entropia::server::Client::run(std::string_view src, std::string& output) {
+#ifdef _WIN32
+	throw std::runtime_error("The daemon is only supported on POSIX systems");
+#else
+	send_message(this->socket, daedalus::entropia::server::MessageKind::RUN, src);
+
+	daedalus::entropia::server::MessageHeader header;
+	DAE_ASSERT_TRUE(
+		receive_message(this->socket, header, output),
+		std::runtime_error("The daemon closed the connection")
+	)
+	DAE_ASSERT_TRUE(
+		header.kind == daedalus::entropia::server::MessageKind::VALUE || header.kind == daedalus::entropia::server::MessageKind::FAILURE,
+		std::runtime_error("Unexpected message " + std::to_string(static_cast<uint32_t>(header.kind)))
+	)
+	return header.kind == daedalus::entropia::server::MessageKind::VALUE;
+#endif
+}
+
+void daedalus::entropia::server::Client::stop() {
+#ifdef _WIN32
+	throw std::runtime_error("The daemon is only supported on POSIX systems");
+#else
+	send_message(this->socket, daedalus::entropia::server::MessageKind::STOP, "");
+
+	daedalus::entropia::server::MessageHeader header;
+	std::string payload;
+	DAE_ASSERT_TRUE(
+		receive_message(this->socket, header, payload),
+		std::runtime_error("The daemon closed the connection")
+	)
+#endif
+}
+
+#pragma endregion
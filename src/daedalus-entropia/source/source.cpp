@@ -0,0 +1,103 @@
+#include <daedalus/Entropia/source/source.hpp>
+
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+daedalus::entropia::source::SourceFile::SourceFile(std::string path) :
+	data(nullptr),
+	size(0),
+	isMapped(false),
+	buffer()
+{
+#ifndef _WIN32
+	int fd = open(path.c_str(), O_RDONLY);
+	DAE_ASSERT_TRUE(
+		fd >= 0,
+		std::runtime_error("Can't open the file")
+	)
+
+	struct stat fileStat;
+	bool isRegular = fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode);
+	if(isRegular && fileStat.st_size > 0) {
+		void* mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapping != MAP_FAILED) {
+			// Read once, from the start to the end
+			(void)madvise(mapping, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+			this->data = static_cast<const char*>(mapping);
+			this->size = static_cast<size_t>(fileStat.st_size);
+			this->isMapped = true;
+			close(fd);
+			return;
+		}
+	}
+
+	// Read from the same descriptor (a pipe can't be opened twice), at once when the size is known
+	this->buffer.resize(isRegular && fileStat.st_size > 0 ? static_cast<size_t>(fileStat.st_size) : daedalus::entropia::source::READ_BLOCK_SIZE);
+	size_t total = 0;
+	while(true) {
+		if(total == this->buffer.size()) {
+			if(isRegular && fileStat.st_size > 0) {
+				break;
+			}
+			this->buffer.resize(this->buffer.size() * 2);
+		}
+		ssize_t count = read(fd, &this->buffer[total], this->buffer.size() - total);
+		if(count < 0 && errno == EINTR) {
+			continue;
+		}
+		if(count <= 0) {
+			break;
+		}
+		total += static_cast<size_t>(count);
+	}
+	close(fd);
+	this->buffer.resize(total);
+	this->size = total;
+#else
+	std::ifstream file = std::ifstream(path, std::ios::binary | std::ios::ate);
+	DAE_ASSERT_TRUE(
+		file.is_open(),
+		std::runtime_error("Can't open the file")
+	)
+	std::streamoff fileSize = file.tellg();
+	if(fileSize > 0 && file.seekg(0)) {
+		this->buffer.resize(static_cast<size_t>(fileSize));
+		file.read(&this->buffer[0], fileSize);
+		this->buffer.resize(static_cast<size_t>(file.gcount()));
+	} else {
+		// Without a known size (pipes), read to the end
+		file.clear();
+		this->buffer.assign(
+			std::istreambuf_iterator<char>(file),
+			std::istreambuf_iterator<char>()
+		);
+	}
+	this->size = this->buffer.size();
+#endif
+}
+
+daedalus::entropia::source::SourceFile::~SourceFile() {
+#ifndef _WIN32
+	if(this->isMapped) {
+		munmap(const_cast<char*>(this->data), this->size);
+	}
+#endif
+}
+
+std::string_view daedalus::entropia::source::SourceFile::get_view() const {
+	return this->isMapped ?
+		std::string_view(this->data, this->size) :
+		std::string_view(this->buffer);
+}
+
+std::string daedalus::entropia::source::SourceFile::to_string() const {
+	return std::string(this->get_view());
+}
@@ -0,0 +1,162 @@
+#include <daedalus/Entropia/stats/stats.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+bool daedalus::entropia::stats::collectStats = false;
+std::atomic<size_t> daedalus::entropia::stats::statementCount = std::atomic<size_t>(0);
+std::atomic<size_t> daedalus::entropia::stats::allocationCount = std::atomic<size_t>(0);
+
+#pragma region PhaseTimer
+
+daedalus::entropia::stats::PhaseTimer::PhaseTimer(daedalus::entropia::stats::Report& report, std::string name) :
+	report(report),
+	name(name),
+	wallStart(std::chrono::steady_clock::now()),
+	cpuStart(std::clock()),
+	isStopped(false)
+{}
+
+daedalus::entropia::stats::PhaseTimer::~PhaseTimer() {
+	this->stop();
+}
+
+void daedalus::entropia::stats::PhaseTimer::stop() {
+	if(this->isStopped) {
+		return;
+	}
+	this->isStopped = true;
+
+	double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->wallStart).count();
+	double cpuMs = 1000.0 * static_cast<double>(std::clock() - this->cpuStart) / CLOCKS_PER_SEC;
+	this->report.phases.push_back({ this->name, wallMs, cpuMs });
+}
+
+#pragma endregion
+
+size_t daedalus::entropia::stats::count_nodes(std::shared_ptr<daedalus::core::ast::Expression> expression) {
+	if(expression == nullptr) {
+		return 0;
+	}
+
+	std::string type = expression->type();
+	// Its tokens aren't nodes until it runs
+	if(type == "LazyScope" && !std::dynamic_pointer_cast<daedalus::entropia::ast::LazyScope>(expression)->is_parsed()) {
+		return 1;
+	}
+
+	size_t count = 1;
+	// The program, a parsed lazy scope, a loop or a branch
+	if(auto scope = std::dynamic_pointer_cast<daedalus::core::ast::Scope>(expression)) {
+		for(std::shared_ptr<daedalus::core::ast::Expression> statement : scope->get_body()) {
+			count += daedalus::entropia::stats::count_nodes(statement);
+		}
+	}
+
+	// The node types of the cache (write_node_record), the literals, identifiers, break and continue have no children
+	if(type == "UnaryExpression") {
+		count += daedalus::entropia::stats::count_nodes(std::dynamic_pointer_cast<daedalus::entropia::ast::UnaryExpression>(expression)->get_term());
+	} else if(type == "BinaryExpression") {
+		auto binaryExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::BinaryExpression>(expression);
+		count += daedalus::entropia::stats::count_nodes(binaryExpression->get_left());
+		count += daedalus::entropia::stats::count_nodes(binaryExpression->get_right());
+	} else if(type == "DeclarationExpression") {
+		auto declarationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::DeclarationExpression>(expression);
+		count += daedalus::entropia::stats::count_nodes(declarationExpression->get_identifier());
+		count += daedalus::entropia::stats::count_nodes(declarationExpression->get_value());
+	} else if(type == "AssignationExpression") {
+		auto assignationExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::AssignationExpression>(expression);
+		count += daedalus::entropia::stats::count_nodes(assignationExpression->get_identifier());
+		count += daedalus::entropia::stats::count_nodes(assignationExpression->get_value());
+	} else if(type == "OrExpression") {
+		count += daedalus::entropia::stats::count_nodes(std::dynamic_pointer_cast<daedalus::entropia::ast::OrExpression>(expression)->get_value());
+	} else if(type == "LoopExpression") {
+		count += daedalus::entropia::stats::count_nodes(std::dynamic_pointer_cast<daedalus::entropia::ast::LoopExpression>(expression)->get_or_expression());
+	} else if(type == "WhileExpression") {
+		auto whileExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::WhileExpression>(expression);
+		count += daedalus::entropia::stats::count_nodes(whileExpression->get_condition());
+		count += daedalus::entropia::stats::count_nodes(whileExpression->get_or_expression());
+	} else if(type == "ForExpression" || type == "ParallelForExpression") {
+		auto forExpression = std::dynamic_pointer_cast<daedalus::entropia::ast::ForExpression>(expression);
+		count += daedalus::entropia::stats::count_nodes(forExpression->get_initial_expression());
+		count += daedalus::entropia::stats::count_nodes(forExpression->get_condition());
+		count += daedalus::entropia::stats::count_nodes(forExpression->get_update_expression());
+		count += daedalus::entropia::stats::count_nodes(forExpression->get_or_expression());
+	} else if(type == "ConditionnalStructure") {
+		for(std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression> conditionnalExpression : std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalStructure>(expression)->get_expressions()) {
+			count += daedalus::entropia::stats::count_nodes(conditionnalExpression);
+		}
+	} else if(type == "ConditionnalExpression") {
+		count += daedalus::entropia::stats::count_nodes(std::dynamic_pointer_cast<daedalus::entropia::ast::ConditionnalExpression>(expression)->get_condition());
+	}
+
+	return count;
+}
+
+size_t daedalus::entropia::stats::get_peak_rss() {
+#ifdef _WIN32
+	return 0;
+#else
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#ifdef __APPLE__
+	// In bytes on macOS
+	return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#else
+	return static_cast<size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+std::string daedalus::entropia::stats::format_report(const daedalus::entropia::stats::Report& report) {
+	std::ostringstream output = std::ostringstream();
+	output << std::fixed << std::setprecision(3);
+
+	double totalWallMs = 0;
+	double totalCpuMs = 0;
+	output << std::left << std::setw(14) << "phase" << std::right << std::setw(12) << "wall ms" << std::setw(12) << "cpu ms" << "\n";
+	for(const daedalus::entropia::stats::PhaseTime& phase : report.phases) {
+		output << std::left << std::setw(14) << phase.name << std::right << std::setw(12) << phase.wallMs << std::setw(12) << phase.cpuMs << "\n";
+		totalWallMs += phase.wallMs;
+		totalCpuMs += phase.cpuMs;
+	}
+	output << std::left << std::setw(14) << "total" << std::right << std::setw(12) << totalWallMs << std::setw(12) << totalCpuMs << "\n";
+
+	output << std::left << std::setw(14) << "cached" << (report.isCached ? "yes" : "no") << "\n";
+	output << std::left << std::setw(14) << "tokens" << report.tokenCount << "\n";
+	output << std::left << std::setw(14) << "nodes" << report.nodeCount << "\n";
+	output << std::left << std::setw(14) << "statements" << daedalus::entropia::stats::statementCount.load() << "\n";
+	output << std::left << std::setw(14) << "allocations" << daedalus::entropia::stats::allocationCount.load() << "\n";
+	output << std::left << std::setw(14) << "peak rss" << daedalus::entropia::stats::get_peak_rss() << " KiB\n";
+	return output.str();
+}
+
+std::string daedalus::entropia::stats::format_json(const daedalus::entropia::stats::Report& report) {
+	std::ostringstream output = std::ostringstream();
+	output << std::fixed << std::setprecision(3);
+
+	double totalWallMs = 0;
+	double totalCpuMs = 0;
+	output << "{\"phases\":[";
+	for(size_t i = 0; i < report.phases.size(); i++) {
+		const daedalus::entropia::stats::PhaseTime& phase = report.phases.at(i);
+		output << (i == 0 ? "" : ",") << "{\"name\":\"" << phase.name << "\",\"wallMs\":" << phase.wallMs << ",\"cpuMs\":" << phase.cpuMs << "}";
+		totalWallMs += phase.wallMs;
+		totalCpuMs += phase.cpuMs;
+	}
+	output << "],\"totalWallMs\":" << totalWallMs << ",\"totalCpuMs\":" << totalCpuMs;
+
+	output << ",\"cached\":" << (report.isCached ? "true" : "false");
+	output << ",\"tokens\":" << report.tokenCount;
+	output << ",\"nodes\":" << report.nodeCount;
+	output << ",\"statements\":" << daedalus::entropia::stats::statementCount.load();
+	output << ",\"allocations\":" << daedalus::entropia::stats::allocationCount.load();
+	output << ",\"peakRssKiB\":" << daedalus::entropia::stats::get_peak_rss() << "}";
+	return output.str();
+}
@@ -0,0 +1,63 @@
+#include <daedalus/Entropia/stream/stream.hpp>
+
+void daedalus::entropia::stream::run_streamed(
+	daedalus::core::Daedalus& daedalusConfig,
+	std::istream& input,
+	std::function<void(const daedalus::entropia::interpreter::LazyResult&)> onResult
+) {
+	daedalus::entropia::checker::TypeChecker checker = daedalus::entropia::checker::TypeChecker();
+	auto env = std::make_shared<daedalus::core::env::Environment>(
+		daedalusConfig.interpreter.envValuesProperties,
+		daedalusConfig.interpreter.validationRules,
+		nullptr
+	);
+
+	auto names = daedalus::entropia::optimizer::TemporaryNames();
+
+	// Tokens of the statement being read, consumed by the parser
+	auto statementTokens = std::vector<daedalus::core::lexer::Token>();
+	size_t depth = 0;
+
+	auto run_statements = [&daedalusConfig, &checker, &names, &env, &statementTokens, &onResult]() {
+		while(!statementTokens.empty()) {
+			std::shared_ptr<daedalus::core::ast::Expression> expression = daedalus::core::parser::parse_expression(daedalusConfig.parser, statementTokens, true);
+			checker.check_statement(expression);
+			for(std::shared_ptr<daedalus::core::ast::Expression> statement : daedalus::entropia::optimizer::optimize_body({ expression }, names)) {
+				std::shared_ptr<daedalus::core::values::RuntimeValue> value = daedalus::core::interpreter::evaluate_statement(daedalusConfig.interpreter, statement, env).value;
+				if(!daedalus::entropia::ast::is_hidden(statement)) {
+					onResult({ statement, value });
+				}
+			}
+		}
+	};
+
+	auto run_segment = [&daedalusConfig, &statementTokens, &depth, &run_statements](const std::string& segment) {
+		auto segmentTokens = std::vector<daedalus::core::lexer::Token>();
+		daedalus::core::lexer::lex(daedalusConfig.lexer, segmentTokens, segment);
+		for(daedalus::core::lexer::Token& token : segmentTokens) {
+			bool isStatementEnd = daedalus::entropia::pipeline::is_statement_end(token, depth);
+			statementTokens.push_back(std::move(token));
+			if(isStatementEnd) {
+				run_statements();
+			}
+		}
+	};
+
+	// The last segment of a block may end inside a line or a literal, it is lexed with the next block
+	std::string pending = "";
+	auto block = std::vector<char>(daedalus::entropia::pipeline::LEXER_SEGMENT_SIZE);
+	while(input.read(block.data(), block.size()) || input.gcount() > 0) {
+		pending.append(block.data(), input.gcount());
+		std::vector<std::string> segments = daedalus::entropia::pipeline::split_source(pending, daedalus::entropia::pipeline::LEXER_SEGMENT_SIZE);
+		if(segments.size() < 2) {
+			continue;
+		}
+		for(size_t i = 0; i + 1 < segments.size(); i++) {
+			run_segment(segments.at(i));
+		}
+		pending = std::move(segments.back());
+	}
+
+	run_segment(pending);
+	run_statements();
+}
@@ -0,0 +1,60 @@
+#ifndef __DAEDALUS_ENTROPIA_BATCH__
+#define __DAEDALUS_ENTROPIA_BATCH__
+
+#include <daedalus/Entropia/cache/cache.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/pool/pool.hpp>
+#include <daedalus/Entropia/program/program.hpp>
+#include <daedalus/Entropia/source/source.hpp>
+
+#include <daedalus/core/interpreter/interpreter.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace batch {
+
+    		/**
+    		 * Run many programs in one process (--batch / --manifest)
+    		 *
+    		 * Each file is lexed, parsed, checked, optimized and interpreted by a job of a work stealing pool, with the shared configuration of get_daedalus.
+    		 * The outcomes are printed in input order, as soon as the files before them are done:
+    		 *
+    		 * <filename> -> <value of the last statement>
+    		 * <filename> !! <error>
+    		 */
+
+    		struct FileResult {
+    			std::string filename;
+    			std::string value;
+    			// Top level results, only recorded on demand
+    			std::vector<daedalus::core::interpreter::RuntimeResult> results;
+    			std::string error;
+    		};
+
+    		/**
+    		 * Get the files listed by a manifest, one path per line (blank lines and # comments ignored)
+    		 */
+    		std::vector<std::string> read_manifest(std::string path);
+
+    		/**
+    		 * Compile (or load from the cache) and run a file, the errors are reported in the result
+    		 */
+    		daedalus::entropia::batch::FileResult run_file(std::string filename, bool recordResults);
+
+    		/**
+    		 * Run the files on threadCount threads and print their outcomes in input order, returns the number of failed files
+    		 */
+    		size_t run_batch(std::vector<std::string> filenames, size_t threadCount, bool recordResults, std::ostream& output);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_BATCH__
@@ -0,0 +1,100 @@
+#ifndef __DAEDALUS_ENTROPIA_CACHE__
+#define __DAEDALUS_ENTROPIA_CACHE__
+
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace cache {
+
+    		/**
+    		 * Precompiled program files (.entc)
+    		 *
+    		 * [CacheHeader][NodeRecord * nodeCount][uint32_t * listSize][char * stringPoolSize]
+    		 *
+    		 * Nodes are stored children first, so a program is rebuilt in a single pass over the records.
+    		 */
+
+    		const uint32_t CACHE_VERSION = 4;
+    		const uint32_t NO_NODE = UINT32_MAX;
+    		// Flags of a DECLARATION record
+    		const uint32_t DECLARATION_MUTABLE = 1;
+    		const uint32_t DECLARATION_HIDDEN = 2;
+
+    		enum class NodeKind : uint32_t {
+    			NUMBER,
+    			BOOLEAN,
+    			CHAR,
+    			STR,
+    			IDENTIFIER,
+    			UNARY,
+    			BINARY,
+    			ASSIGNATION,
+    			DECLARATION,
+    			OR,
+    			LOOP,
+    			WHILE,
+    			FOR,
+    			BREAK,
+    			CONTINUE,
+    			CONDITIONNAL_EXPRESSION,
+    			CONDITIONNAL_STRUCTURE,
+    			// FOR record of the loop, reductions as "<name>:<operator>,..."
+    			PAR_FOR
+    		};
+
+    		struct CacheHeader {
+    			char magic[4];
+    			uint32_t version;
+    			uint64_t hash;
+    			uint32_t nodeCount;
+    			uint32_t listSize;
+    			uint32_t stringPoolSize;
+    			uint32_t programList;
+    			uint32_t programSize;
+    			uint32_t byteOrder;
+    		};
+
+    		struct NodeRecord {
+    			NodeKind kind;
+    			uint32_t flags;
+    			uint32_t operands[8];
+    			double number;
+    		};
+
+    		/**
+    		 * Get the FNV-1a hash of a source
+    		 */
+    		uint64_t hash_source(std::string_view src);
+
+    		/**
+    		 * Get the cache file of a source, next to it or in ENTROPIA_CACHE_DIR if set
+    		 */
+    		std::string get_cache_path(std::string filename, uint64_t hash);
+
+    		/**
+    		 * Check if the cache is enabled (disabled by ENTROPIA_CACHE=0 or ENTROPIA_OPTIMIZE=0)
+    		 */
+    		bool is_cache_enabled();
+
+    		/**
+    		 * Serialize a program in a cache file
+    		 */
+    		void save_program(std::string path, uint64_t hash, std::shared_ptr<daedalus::core::ast::Scope> program);
+
+    		/**
+    		 * Load a program from a cache file, returns nullptr if the file is missing, outdated or built from another source
+    		 */
+    		std::shared_ptr<daedalus::core::ast::Scope> load_program(std::string path, uint64_t hash);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_CACHE__
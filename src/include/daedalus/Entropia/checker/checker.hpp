@@ -0,0 +1,84 @@
+#ifndef __DAEDALUS_ENTROPIA_CHECKER__
+#define __DAEDALUS_ENTROPIA_CHECKER__
+
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace checker {
+
+    		// Type of the number literals and of the arithmetic between different number types
+    		const std::string NUMBER_TYPE = "number";
+    		// Type of the statements that don't produce a value (break / continue)
+    		const std::string NO_TYPE = "";
+    		// Type of the values that can be of different types (e.g. loop with a bool body and an i32 or value)
+    		const std::string MIXED_TYPE = "mixed";
+
+    		bool is_number_type(std::string type);
+
+    		/**
+    		 * Check if a value of the source type can be stored in a value of the target type
+    		 */
+    		bool is_assignable(std::string target, std::string source);
+
+    		/**
+    		 * Get the type of a value that can either be of the first or second type
+    		 */
+    		std::string unify_types(std::string first, std::string second);
+
+    		class TypeChecker {
+    		public:
+    			/**
+    			 * Create a new Type Checker, with the types of the values declared by the host (immutable)
+    			 */
+    			TypeChecker(std::unordered_map<std::string, std::string> globals = std::unordered_map<std::string, std::string>());
+
+    			/**
+    			 * Create a Type Checker for a deferred body, in the state of the one that deferred it
+    			 */
+    			TypeChecker(daedalus::entropia::ast::DeferredCheck deferredCheck);
+
+    			/**
+    			 * Infer the type of every expression of the program, annotate the nodes and throw on type mismatches
+    			 */
+    			void check(std::shared_ptr<daedalus::core::ast::Scope> program);
+
+    			/**
+    			 * Check a top level statement, after the ones checked before it (program checked while it is parsed)
+    			 */
+    			void check_statement(std::shared_ptr<daedalus::core::ast::Expression> statement);
+
+    			std::string infer_type(std::shared_ptr<daedalus::core::ast::Expression> expression, std::string& escapeType);
+
+    		private:
+    			std::string infer_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body, std::string& escapeType);
+    			std::string get_declared_type(std::string name);
+    			size_t get_declaration_scope(std::string name);
+
+    			/**
+    			 * Check a par for: counted, no break out of it, and no write to an outer value but its reductions (s = s <operator> <expression without s>)
+    			 */
+    			std::string infer_parallel_for(std::shared_ptr<daedalus::entropia::ast::ParallelForExpression> parallelForExpression, std::string& escapeType);
+
+    			std::vector<std::unordered_map<std::string, std::string>> scopes;
+    			// Declared by the host, immutable
+    			std::unordered_set<std::string> globals;
+
+    			// Innermost par for being checked: its reductions, the first scope of its body (0 outside of one) and the loops nested in it
+    			std::unordered_map<std::string, std::string> reductions;
+    			size_t parallelScope;
+    			size_t parallelLoops;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_CHECKER__
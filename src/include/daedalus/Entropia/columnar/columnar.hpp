@@ -0,0 +1,140 @@
+#ifndef __DAEDALUS_ENTROPIA_COLUMNAR__
+#define __DAEDALUS_ENTROPIA_COLUMNAR__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/parser/ast.hpp>
+#include <daedalus/Entropia/program/program.hpp>
+
+#include <daedalus/core/core.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace columnar {
+
+    		/**
+    		 * Vectorized run of a program over a batch of rows (--records --columnar)
+    		 *
+    		 * Each node is dispatched once per batch and computes a column: one value per row, in a plain array of its type.
+    		 * The operations are loops over whole columns, vectorized by the compiler.
+    		 * A branch runs under the mask of the rows selecting it, and its value is blended into the value of the conditionnal.
+    		 * A row failing (division by zero, invalid field) keeps its first error and is ignored by the next statements.
+    		 *
+    		 * Only the programs made of numbers, bools and chars (literals, inputs, values, operators and if / else) have a columnar version.
+    		 */
+
+    		const size_t BATCH_SIZE = 1024;
+
+    		enum class ColumnType {
+    			NONE,
+    			NUMBER,
+    			BOOLEAN,
+    			CHAR
+    		};
+
+    		/**
+    		 * Values of an expression for each row of a batch, only the array of its type is used
+    		 */
+    		struct Column {
+    			daedalus::entropia::columnar::ColumnType type;
+    			std::vector<double> numbers;
+    			std::vector<uint8_t> booleans;
+    			std::vector<char> chars;
+    		};
+
+    		struct Batch {
+    			size_t size;
+    			std::unordered_map<std::string, daedalus::entropia::columnar::Column> inputs;
+    			// First error of each row
+    			std::vector<uint8_t> failed;
+    			std::vector<std::string> errors;
+    		};
+
+    		/**
+    		 * Column type of a checker type, throws for the types without one
+    		 */
+    		daedalus::entropia::columnar::ColumnType get_column_type(std::string type);
+
+    		daedalus::entropia::columnar::Column make_column(daedalus::entropia::columnar::ColumnType type, size_t size);
+
+    		/**
+    		 * Add a row to a batch (default values in each input column), gives its index
+    		 */
+    		size_t add_row(daedalus::entropia::columnar::Batch& batch);
+    		void fail_row(daedalus::entropia::columnar::Batch& batch, size_t row, std::string error);
+    		void clear_batch(daedalus::entropia::columnar::Batch& batch);
+
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> get_row_value(const daedalus::entropia::columnar::Column& column, size_t row);
+
+    		class ColumnarProgram {
+    		public:
+    			/**
+    			 * Type the columns of a compiled program, throws when it uses a node, an operator or a type without column kernel
+    			 */
+    			ColumnarProgram(std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program);
+
+    			/**
+    			 * Empty batch, with a column for each input of a column type
+    			 */
+    			daedalus::entropia::columnar::Batch make_batch() const;
+
+    			/**
+    			 * Run the program over the rows of a batch, gives the value of its last statement for each of them (a compiled program is never modified, any number of threads can run it)
+    			 */
+    			daedalus::entropia::columnar::Column run(daedalus::entropia::columnar::Batch& batch) const;
+
+    		private:
+    			typedef std::vector<std::unordered_map<std::string, daedalus::entropia::columnar::ColumnType>> TypeScopes;
+    			typedef std::vector<std::unordered_map<std::string, daedalus::entropia::columnar::Column>> ColumnScopes;
+
+    			daedalus::entropia::columnar::ColumnType infer_type(std::shared_ptr<daedalus::core::ast::Expression> expression, TypeScopes& scopes);
+    			daedalus::entropia::columnar::ColumnType infer_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body, TypeScopes& scopes);
+
+    			/**
+    			 * Column of an expression, only the rows of the mask reach it (the others get unspecified values)
+    			 */
+    			daedalus::entropia::columnar::Column evaluate(
+    				std::shared_ptr<daedalus::core::ast::Expression> expression,
+    				const std::vector<uint8_t>& mask,
+    				daedalus::entropia::columnar::Batch& batch,
+    				ColumnScopes& scopes
+    			) const;
+    			daedalus::entropia::columnar::Column evaluate_body(
+    				std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+    				const std::vector<uint8_t>& mask,
+    				daedalus::entropia::columnar::Batch& batch,
+    				ColumnScopes& scopes
+    			) const;
+    			daedalus::entropia::columnar::Column evaluate_binary_expression(
+    				std::shared_ptr<daedalus::entropia::ast::BinaryExpression> binaryExpression,
+    				const std::vector<uint8_t>& mask,
+    				daedalus::entropia::columnar::Batch& batch,
+    				ColumnScopes& scopes
+    			) const;
+    			daedalus::entropia::columnar::Column evaluate_conditionnal_structure(
+    				std::shared_ptr<daedalus::entropia::ast::ConditionnalStructure> conditionnalStructure,
+    				const std::vector<uint8_t>& mask,
+    				daedalus::entropia::columnar::Batch& batch,
+    				ColumnScopes& scopes
+    			) const;
+
+    			std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program;
+    			// Inputs with a column type (the others are never read)
+    			std::unordered_map<std::string, daedalus::entropia::columnar::ColumnType> inputTypes;
+    			// Type of the column of each node, set once by the constructor
+    			std::unordered_map<daedalus::core::ast::Expression*, daedalus::entropia::columnar::ColumnType> types;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_COLUMNAR__
@@ -0,0 +1,107 @@
+#ifndef __DAEDALUS_ENTROPIA_COMPILER__
+#define __DAEDALUS_ENTROPIA_COMPILER__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <daedalus/core/interpreter/interpreter.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Receives the value of each top level statement of a native program, in order
+ * Must match the definition written in the generated sources
+ */
+struct entropia_recorder {
+	void (*number)(void* context, double value);
+	void (*boolean)(void* context, bool value);
+	void (*character)(void* context, char value);
+	void (*string)(void* context, const char* value);
+	void (*null)(void* context);
+	void* context;
+};
+
+namespace daedalus {
+    namespace entropia {
+    	namespace compiler {
+
+    		enum class BuildKind {
+    			EXECUTABLE,
+    			SHARED_OBJECT
+    		};
+
+    		/**
+    		 * Variable receiving the value of a statement, discarded when the name is empty
+    		 */
+    		struct ValueTarget {
+    			std::string name;
+    			std::string type;
+    		};
+
+    		/**
+    		 * Translate a checked program to a C++ translation unit
+    		 * The unit exports entropia_source_hash and entropia_run(entropia_recorder*), and a main printing the values with ENTROPIA_EXECUTABLE
+    		 */
+    		class SourceGenerator {
+    		public:
+    			SourceGenerator();
+
+    			std::string generate(std::shared_ptr<daedalus::core::ast::Scope> program, uint64_t hash);
+
+    		private:
+    			std::string get_c_type(std::string type);
+    			std::string get_value_type(std::shared_ptr<daedalus::core::ast::Expression> expression);
+    			std::string get_truthiness(std::string value, std::string type);
+    			std::string make_temporary(std::string type, std::string& out, int indent);
+    			bool is_mutable(std::string name);
+
+    			void emit_assignment(const ValueTarget& target, std::string value, std::string type, std::string& out, int indent);
+    			std::string emit_value(std::shared_ptr<daedalus::core::ast::Expression> expression, std::string& out, int indent);
+    			void emit_statement(std::shared_ptr<daedalus::core::ast::Expression> expression, const ValueTarget& target, std::string& out, int indent);
+    			void emit_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body, const ValueTarget& target, std::string& out, int indent);
+    			void emit_loop(std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression, const ValueTarget& target, std::string& out, int indent);
+    			void emit_conditionnal_expressions(
+    				std::vector<std::shared_ptr<daedalus::entropia::ast::ConditionnalExpression>> expressions,
+    				size_t index,
+    				const ValueTarget& target,
+    				std::string& out,
+    				int indent
+    			);
+
+    			size_t temporaryCount;
+    			size_t loopDepth;
+    			// Mutability of the declared values, by scope
+    			std::vector<std::unordered_map<std::string, bool>> scopes;
+    		};
+
+    		/**
+    		 * Write the sources next to the output and build them with $CXX (c++ by default)
+    		 */
+    		void build(std::string source, std::string output, daedalus::entropia::compiler::BuildKind kind);
+
+    		/**
+    		 * Shared object path matching a cache path (main.entc -> main.so)
+    		 */
+    		std::string get_library_path(std::string cache_path);
+
+    		/**
+    		 * Run the shared object built from the program, false when missing or built from another source
+    		 */
+    		bool run_library(
+    			std::string path,
+    			uint64_t hash,
+    			std::shared_ptr<daedalus::core::ast::Scope> program,
+    			std::vector<daedalus::core::interpreter::RuntimeResult>& results
+    		);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_COMPILER__
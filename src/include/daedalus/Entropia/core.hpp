@@ -3,6 +3,20 @@
 
 #include <daedalus/Entropia/lexer/lexer.hpp>
 #include <daedalus/Entropia/parser/parser.hpp>
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+#include <daedalus/Entropia/cache/cache.hpp>
+#include <daedalus/Entropia/source/source.hpp>
 #include <daedalus/Entropia/interpreter/interpreter.hpp>
+#include <daedalus/Entropia/compiler/compiler.hpp>
+#include <daedalus/Entropia/program/program.hpp>
+#include <daedalus/Entropia/pipeline/pipeline.hpp>
+#include <daedalus/Entropia/stream/stream.hpp>
+#include <daedalus/Entropia/pool/pool.hpp>
+#include <daedalus/Entropia/batch/batch.hpp>
+#include <daedalus/Entropia/columnar/columnar.hpp>
+#include <daedalus/Entropia/record/record.hpp>
+#include <daedalus/Entropia/server/server.hpp>
+#include <daedalus/Entropia/stats/stats.hpp>
 
 #endif // __DAEDALUS_ENTROPIA_CORE__
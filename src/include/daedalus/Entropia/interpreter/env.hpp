@@ -10,7 +10,6 @@ namespace daedalus {
     namespace entropia {
         namespace env {
     		daedalus::core::env::EnvValue validate_mutability(daedalus::core::env::EnvValue env_value, std::shared_ptr<daedalus::core::values::RuntimeValue> new_value, std::string key);
-    		daedalus::core::env::EnvValue validate_type_cast(daedalus::core::env::EnvValue env_value, std::shared_ptr<daedalus::core::values::RuntimeValue> new_value, std::string key);
     	}
     }
 }
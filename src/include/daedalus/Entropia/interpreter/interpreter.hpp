@@ -2,15 +2,25 @@
 #define __DAEDALUS_ENTROPIA_INTERPRETER__
 
 #include <daedalus/Entropia/parser/ast.hpp>
+#include <daedalus/Entropia/parser/parser.hpp>
 #include <daedalus/Entropia/interpreter/values.hpp>
 #include <daedalus/Entropia/interpreter/env.hpp>
+#include <daedalus/Entropia/interpreter/region.hpp>
+#include <daedalus/Entropia/jit/jit.hpp>
+#include <daedalus/Entropia/pool/pool.hpp>
+#include <daedalus/Entropia/stats/stats.hpp>
 
 #include <daedalus/core/interpreter/interpreter.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -82,6 +92,20 @@ namespace daedalus {
     			std::shared_ptr<daedalus::core::ast::Statement> statement,
     			std::shared_ptr<daedalus::core::env::Environment> env
     		);
+
+    		// Fixed split of the iterations of a par for, so the reductions are combined in the same order whatever the number of threads
+    		const size_t PARALLEL_CHUNKS = 64;
+    		// Below, the chunks run on the current thread
+    		const size_t PARALLEL_MIN_ITERATIONS = 1024;
+
+    		/**
+    		 * Run the chunks of iterations of a par for on the pool, each with its own loop variable and reductions, then combine them in order
+    		 */
+    		daedalus::core::interpreter::RuntimeValueWrapper evaluate_parallel_for_expression(
+    			daedalus::core::interpreter::Interpreter& interpreter,
+    			std::shared_ptr<daedalus::core::ast::Statement> statement,
+    			std::shared_ptr<daedalus::core::env::Environment> env
+    		);
     		daedalus::core::interpreter::RuntimeValueWrapper evaluate_break_expression(
     			daedalus::core::interpreter::Interpreter& interpreter,
     			std::shared_ptr<daedalus::core::ast::Statement> statement,
@@ -97,6 +121,44 @@ namespace daedalus {
     			std::shared_ptr<daedalus::core::ast::Statement> statement,
     			std::shared_ptr<daedalus::core::env::Environment> env
     		);
+
+    		daedalus::core::interpreter::RuntimeValueWrapper evaluate_lazy_scope(
+    			daedalus::core::interpreter::Interpreter& interpreter,
+    			std::shared_ptr<daedalus::core::ast::Statement> statement,
+    			std::shared_ptr<daedalus::core::env::Environment> env
+    		);
+
+    		/**
+    		 * Top level statement and its value, formatted only when read
+    		 */
+    		struct LazyResult {
+    			std::shared_ptr<daedalus::core::ast::Statement> statement;
+    			std::shared_ptr<daedalus::core::values::RuntimeValue> value;
+
+    			daedalus::core::interpreter::RuntimeResult get() const;
+    		};
+
+    		/**
+    		 * Evaluate the statements of a scope like daedalus::core::interpreter::evaluate_scope, without formatting a result for each of them
+    		 * A new environment is created when scope_env is nullptr
+    		 */
+    		daedalus::core::interpreter::RuntimeValueWrapper evaluate_body(
+    			daedalus::core::interpreter::Interpreter& interpreter,
+    			std::shared_ptr<daedalus::core::ast::Scope> scope,
+    			std::shared_ptr<daedalus::core::env::Environment> scope_env,
+    			std::shared_ptr<daedalus::core::env::Environment> parent_env
+    		);
+
+    		/**
+    		 * Run the program in a new environment (child of parent_env), its top level results are only recorded when results isn't nullptr
+    		 * Gives the value of the last statement
+    		 */
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> interpret(
+    			daedalus::core::interpreter::Interpreter& interpreter,
+    			std::shared_ptr<daedalus::core::ast::Scope> program,
+    			std::vector<daedalus::entropia::interpreter::LazyResult>* results,
+    			std::shared_ptr<daedalus::core::env::Environment> parent_env = nullptr
+    		);
     	}
     }
 }
@@ -0,0 +1,140 @@
+#ifndef __DAEDALUS_ENTROPIA_REGION__
+#define __DAEDALUS_ENTROPIA_REGION__
+
+#include <daedalus/Entropia/stats/stats.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace region {
+
+    		/**
+    		 * Bump allocated memory of the values created by the iterations of a loop
+    		 *
+    		 * A chunk is aligned on its size, so a value finds its chunk back from its own address.
+    		 * Its count holds one reference for the region using it, and one per value still alive.
+    		 * At the end of an iteration:
+    		 * - a chunk only referenced by its region is rewound (the temporaries are released in bulk)
+    		 * - a chunk holding an escaping value (bound in an outer scope, loop result, ...) is retired, and the region takes another one:
+    		 *   the retired chunk goes back to the cache of its thread once its last value dies
+    		 * A loop updating an outer value so cycles between a few cached chunks, but a long-lived escaping value keeps its whole chunk.
+    		 */
+
+    		const size_t CHUNK_SIZE = 64 * 1024;
+    		const size_t CHUNK_ALIGNMENT = 16;
+    		// Kept by each thread for the next regions
+    		const size_t CACHED_CHUNKS = 8;
+
+    		struct Chunk {
+    			std::atomic<size_t> references;
+    			size_t offset;
+    		};
+
+    		const size_t CHUNK_HEADER_SIZE = (sizeof(daedalus::entropia::region::Chunk) + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+
+    		inline size_t get_allocation_size(size_t size) {
+    			return (size + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+    		}
+
+    		/**
+    		 * Larger allocations stay on the heap
+    		 */
+    		inline bool fits_in_chunk(size_t size) {
+    			return daedalus::entropia::region::get_allocation_size(size) <= CHUNK_SIZE - CHUNK_HEADER_SIZE;
+    		}
+
+    		class Region {
+    		public:
+    			/**
+    			 * Become the region of the current thread until destroyed
+    			 */
+    			Region();
+    			~Region();
+
+    			Region(const Region&) = delete;
+    			Region& operator=(const Region&) = delete;
+
+    			/**
+    			 * The size must fit in a chunk
+    			 */
+    			void* allocate(size_t size);
+
+    			/**
+    			 * Release the temporaries of the iteration at once, or retire the chunk when one of them escaped
+    			 */
+    			void next_iteration();
+
+    			static daedalus::entropia::region::Region* get_current();
+
+    		private:
+    			daedalus::entropia::region::Chunk* chunk;
+    			daedalus::entropia::region::Region* previous;
+    		};
+
+    		/**
+    		 * Release a value allocated in a region (from any thread)
+    		 */
+    		void deallocate(void* pointer);
+
+    		/**
+    		 * Allocator of the values (and their control blocks) created while a region is active
+    		 */
+    		template<typename T>
+    		class RegionAllocator {
+    		public:
+    			typedef T value_type;
+
+    			RegionAllocator(daedalus::entropia::region::Region* region) : region(region) {}
+
+    			template<typename U>
+    			RegionAllocator(const RegionAllocator<U>& other) : region(other.region) {}
+
+    			T* allocate(size_t count) {
+    				if(!daedalus::entropia::region::fits_in_chunk(count * sizeof(T))) {
+    					return static_cast<T*>(::operator new(count * sizeof(T)));
+    				}
+    				return static_cast<T*>(this->region->allocate(count * sizeof(T)));
+    			}
+
+    			void deallocate(T* pointer, size_t count) {
+    				if(!daedalus::entropia::region::fits_in_chunk(count * sizeof(T))) {
+    					::operator delete(pointer);
+    					return;
+    				}
+    				daedalus::entropia::region::deallocate(pointer);
+    			}
+
+    			template<typename U>
+    			bool operator==(const RegionAllocator<U>& other) const {
+    				return this->region == other.region;
+    			}
+    			template<typename U>
+    			bool operator!=(const RegionAllocator<U>& other) const {
+    				return this->region != other.region;
+    			}
+
+    			daedalus::entropia::region::Region* region;
+    		};
+
+    		/**
+    		 * Create a value in the region of the current thread, on the heap without one (counted by the stats either way)
+    		 */
+    		template<typename T, typename... Args>
+    		std::shared_ptr<T> make_value(Args&&... args) {
+    			daedalus::entropia::stats::count_allocation();
+    			daedalus::entropia::region::Region* region = daedalus::entropia::region::Region::get_current();
+    			if(region == nullptr) {
+    				return std::make_shared<T>(std::forward<Args>(args)...);
+    			}
+    			return std::allocate_shared<T>(daedalus::entropia::region::RegionAllocator<T>(region), std::forward<Args>(args)...);
+    		}
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_REGION__
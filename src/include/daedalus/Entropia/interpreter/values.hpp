@@ -3,6 +3,7 @@
 
 #include <daedalus/core/interpreter/values.hpp>
 
+#include <memory>
 #include <string>
 
 namespace daedalus {
@@ -42,22 +43,55 @@ namespace daedalus {
     			char value;
     		};
 
+    		/**
+    		 * Immutable characters shared by the values (and the literal), the short ones stored inline in the same allocation
+    		 */
+    		typedef std::shared_ptr<const std::string> SharedString;
+
+    		/**
+    		 * Unique shared copy of the characters, two interned strings are equal only when they're the same
+    		 */
+    		daedalus::entropia::values::SharedString intern_string(const std::string& value);
+
     		class StrValue : public daedalus::core::values::RuntimeValue {
     		public:
     			/**
     			 * Create a new String Value
     			 */
     			StrValue(std::string value = "");
+    			StrValue(daedalus::entropia::values::SharedString value, bool isInterned);
 
-    			std::string get();
+    			const std::string& get();
+    			bool is_interned();
+    			/**
+    			 * Pointer compare, then length and characters when one of them isn't interned
+    			 */
+    			bool equals(daedalus::entropia::values::StrValue& other);
 
     			virtual std::string type() override;
     			virtual std::string repr() override;
     			virtual bool IsTrue() override;
 
     		private:
-    			std::string value;
+    			daedalus::entropia::values::SharedString value;
+    			bool isInterned;
     		};
+
+    		/**
+    		 * Shared immutable values, never allocated at runtime
+    		 * The integers in [SMALL_INTEGER_MIN, SMALL_INTEGER_MAX] and every char are created once
+    		 */
+
+    		const int SMALL_INTEGER_MIN = -128;
+    		const int SMALL_INTEGER_MAX = 1023;
+
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> get_boolean(bool value);
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> get_null();
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> get_char(char value);
+    		/**
+    		 * Cached small integer, a new value (in the current region) otherwise
+    		 */
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> get_number(double value);
     	}
     }
 }
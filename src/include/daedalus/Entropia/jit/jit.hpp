@@ -0,0 +1,178 @@
+#ifndef __DAEDALUS_ENTROPIA_JIT__
+#define __DAEDALUS_ENTROPIA_JIT__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <daedalus/core/interpreter/env.hpp>
+#include <daedalus/core/interpreter/interpreter.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace jit {
+
+    		/**
+    		 * Baseline x86-64 compiler for the hot loops (--jit)
+    		 *
+    		 * A loop running more than HOT_LOOP_THRESHOLD iterations is compiled, then runs its remaining iterations natively.
+    		 * Every value lives in a frame of doubles (booleans as 0 / 1), loaded from and written back to the environment around the call:
+    		 *
+    		 * [result value][result kind][ran][variables and temporaries]
+    		 *
+    		 * The loops using anything else than numbers / booleans, nested loops or unparsed lazy scopes stay interpreted.
+    		 * Each thread counts and compiles its own hot loops, dropped once their program is freed. jitLoops is only set before running.
+    		 */
+
+    		extern bool jitLoops;
+
+    		const uint64_t HOT_LOOP_THRESHOLD = 64;
+
+    		enum class SlotKind {
+    			NUMBER,
+    			BOOLEAN,
+    			NONE
+    		};
+
+    		enum class ExitStatus : uint64_t {
+    			DONE,
+    			DIVIDE_BY_ZERO,
+    			NO_CONDITION_MATCHED
+    		};
+
+    		/**
+    		 * x86-64 machine code buffer, every value addressed from the frame in rdi
+    		 */
+    		class Assembler {
+    		public:
+    			Assembler();
+
+    			std::vector<uint8_t> finish();
+
+    			size_t new_label();
+    			void bind(size_t label);
+
+    			void load(int xmm, size_t slot);
+    			void store(size_t slot, int xmm);
+    			void load_constant(int xmm, double value);
+    			void store_constant(size_t slot, double value);
+    			void move(int destination, int source);
+
+    			// xmm0 = xmm0 <op> xmm1
+    			void arithmetic(uint8_t opcode);
+    			// eax = predicate(xmm<left>, xmm<right>) ? 1 : 0
+    			void compare(int left, int right, uint8_t predicate);
+    			// eax = xmm0 != 0
+    			void truthiness();
+    			void boolean_to_number();
+    			void negate_boolean();
+    			void bitwise(uint8_t opcode);
+
+    			void jump(size_t label);
+    			void jump_if_false(size_t label);
+    			// Jumps when xmm1 is 0 (and not NaN)
+    			void jump_if_zero_divisor(size_t label);
+    			void exit(daedalus::entropia::jit::ExitStatus status);
+
+    		private:
+    			void emit(std::vector<uint8_t> bytes);
+    			void emit_slot(uint8_t opcode_prefix, uint8_t opcode, int xmm, size_t slot);
+    			void emit_label(size_t label);
+
+    			std::vector<uint8_t> code;
+    			std::vector<size_t> labels;
+    			std::vector<std::pair<size_t, size_t>> fixups;
+    		};
+
+    		struct LocalVariable {
+    			size_t slot;
+    			daedalus::entropia::jit::SlotKind kind;
+    			bool isMutable;
+    		};
+
+    		struct FreeVariable {
+    			std::string name;
+    			size_t slot;
+    			daedalus::entropia::jit::SlotKind kind;
+    			bool isAssigned;
+    		};
+
+    		/**
+    		 * Executable copy of a compiled loop
+    		 */
+    		class NativeLoop {
+    		public:
+    			NativeLoop(std::vector<uint8_t> code, std::vector<daedalus::entropia::jit::FreeVariable> freeVariables, size_t frameSize);
+    			~NativeLoop();
+
+    			NativeLoop(const NativeLoop&) = delete;
+    			NativeLoop& operator=(const NativeLoop&) = delete;
+
+    			daedalus::entropia::jit::ExitStatus run(double* frame);
+
+    			std::vector<daedalus::entropia::jit::FreeVariable> freeVariables;
+    			size_t frameSize;
+
+    		private:
+    			void* memory;
+    			size_t size;
+    		};
+
+    		/**
+    		 * Compile a loop (condition + body), throws when a node isn't supported
+    		 */
+    		class LoopCompiler {
+    		public:
+    			LoopCompiler();
+
+    			std::unique_ptr<daedalus::entropia::jit::NativeLoop> compile(std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression);
+
+    		private:
+    			daedalus::entropia::jit::SlotKind get_kind(std::string type);
+    			size_t get_variable(std::string name, daedalus::entropia::jit::SlotKind kind, bool isAssigned);
+    			size_t get_temporary(size_t depth);
+
+    			// Load a literal / identifier in xmm, NONE for the other nodes
+    			daedalus::entropia::jit::SlotKind emit_operand(std::shared_ptr<daedalus::core::ast::Expression> expression, int xmm);
+    			// Compute the expression in xmm0
+    			daedalus::entropia::jit::SlotKind emit_expression(std::shared_ptr<daedalus::core::ast::Expression> expression, size_t depth);
+    			void emit_condition(std::shared_ptr<daedalus::core::ast::Expression> expression, size_t label);
+    			void emit_result(daedalus::entropia::jit::SlotKind kind);
+    			void emit_statement(std::shared_ptr<daedalus::core::ast::Expression> expression);
+    			void emit_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body);
+
+    			daedalus::entropia::jit::Assembler assembler;
+    			// Declared in the loop, by scope
+    			std::vector<std::unordered_map<std::string, daedalus::entropia::jit::LocalVariable>> scopes;
+    			std::vector<daedalus::entropia::jit::FreeVariable> freeVariables;
+    			std::vector<size_t> temporaries;
+    			size_t slotCount;
+    			size_t loopStart;
+    			size_t loopEnd;
+    			size_t divideByZero;
+    			size_t noConditionMatched;
+    		};
+
+    		/**
+    		 * Count an iteration of the loop, and once hot run its remaining iterations natively
+    		 * True when the loop is over (scope_result then holds its value), false to interpret the iteration
+    		 */
+    		bool run_hot_loop(
+    			std::shared_ptr<daedalus::entropia::ast::LoopExpression> loopExpression,
+    			std::shared_ptr<daedalus::core::env::Environment> env,
+    			daedalus::core::interpreter::RuntimeValueWrapper& scope_result
+    		);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_JIT__
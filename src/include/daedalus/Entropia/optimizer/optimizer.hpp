@@ -0,0 +1,100 @@
+#ifndef __DAEDALUS_ENTROPIA_OPTIMIZER__
+#define __DAEDALUS_ENTROPIA_OPTIMIZER__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace optimizer {
+    		typedef std::function<std::shared_ptr<daedalus::core::ast::Expression>(std::shared_ptr<daedalus::core::ast::Expression>)> ExpressionMapper;
+    		typedef std::function<std::vector<std::shared_ptr<daedalus::core::ast::Expression>>(std::vector<std::shared_ptr<daedalus::core::ast::Expression>>)> BodyMapper;
+
+    		// Shared side effect free nodes, by structural key
+    		typedef std::unordered_map<std::string, std::shared_ptr<daedalus::core::ast::Expression>> ExpressionPool;
+
+    		/**
+    		 * Suffixes of the hidden declarations (the identifiers can't contain digits, no user value can collide)
+    		 * Counted per compiled program, its names (and cache file) don't depend on the programs compiled before it
+    		 */
+    		struct TemporaryNames {
+    			size_t commonSubexpressionCount = 0;
+    			size_t loopInvariantCount = 0;
+    		};
+
+    		/**
+    		 * Copy of the node with its child expressions and bodies mapped, the node itself when nothing changed
+    		 */
+    		std::shared_ptr<daedalus::core::ast::Expression> map_children(
+    			std::shared_ptr<daedalus::core::ast::Expression> expression,
+    			const daedalus::entropia::optimizer::ExpressionMapper& map_expression,
+    			const daedalus::entropia::optimizer::BodyMapper& map_body
+    		);
+
+    		/**
+    		 * Structural key of a side effect free node (literal, identifier, unary / binary expression whose children are already shared)
+    		 * Empty for the other nodes
+    		 */
+    		std::string get_expression_key(std::shared_ptr<daedalus::core::ast::Expression> expression);
+
+    		/**
+    		 * Share the identical side effect free subtrees (hash-consing)
+    		 */
+    		std::shared_ptr<daedalus::core::ast::Expression> share_expression(
+    			std::shared_ptr<daedalus::core::ast::Expression> expression,
+    			daedalus::entropia::optimizer::ExpressionPool& pool
+    		);
+
+    		/**
+    		 * Compute the side effect free expressions repeated in a straight-line scope once, in a hidden declaration
+    		 * Needs the shared expressions, identical expressions being the same node
+    		 */
+    		std::vector<std::shared_ptr<daedalus::core::ast::Expression>> eliminate_common_subexpressions(
+    			std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+    			daedalus::entropia::optimizer::ExpressionPool& pool,
+    			daedalus::entropia::optimizer::TemporaryNames& names
+    		);
+
+    		/**
+    		 * Compute the side effect free expressions of a loop whose inputs it doesn't assign once, in hidden declarations before it
+    		 * Needs the shared expressions, identical expressions being the same node
+    		 */
+    		std::vector<std::shared_ptr<daedalus::core::ast::Expression>> hoist_loop_invariants(
+    			std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+    			daedalus::entropia::optimizer::ExpressionPool& pool,
+    			daedalus::entropia::optimizer::TemporaryNames& names
+    		);
+
+    		/**
+    		 * Check if the optimizer is enabled (disabled by ENTROPIA_OPTIMIZE=0, to compare the results of a program with and without it)
+    		 */
+    		bool is_optimizer_enabled();
+
+    		/**
+    		 * Fold the constants, prune the dead conditionnal branches / loops, drop unreachable statements,
+    		 * eliminate the common subexpressions and hoist the loop invariants
+    		 * The statements of a program optimized one by one (stream, pipeline) share their names
+    		 * The body is kept as is when the optimizer is disabled
+    		 */
+    		std::vector<std::shared_ptr<daedalus::core::ast::Expression>> optimize_body(
+    			std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body,
+    			daedalus::entropia::optimizer::TemporaryNames& names
+    		);
+
+    		std::shared_ptr<daedalus::core::ast::Scope> optimize(std::shared_ptr<daedalus::core::ast::Scope> program);
+
+    		/**
+    		 * Induction variable of a canonical for loop, nullptr when the body can assign it, its bound or continue
+    		 */
+    		std::shared_ptr<daedalus::entropia::ast::CountedLoop> get_counted_loop(std::shared_ptr<daedalus::entropia::ast::ForExpression> forExpression);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_OPTIMIZER__
@@ -1,12 +1,23 @@
 #ifndef __DAEDALUS_ENTROPIA_AST__
 #define __DAEDALUS_ENTROPIA_AST__
 
+#include <daedalus/Entropia/interpreter/values.hpp>
+
+#include <daedalus/core/interpreter/values.hpp>
+#include <daedalus/core/lexer/lexer.hpp>
 #include <daedalus/core/parser/ast.hpp>
+#include <daedalus/core/parser/parser.hpp>
 #include <daedalus/core/tools/assert.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace daedalus {
@@ -44,6 +55,7 @@ namespace daedalus {
 			class LoopExpression;
 			class WhileExpression;
 			class ForExpression;
+			class ParallelForExpression;
 
 			class BreakExpression;
 			class ContinueExpression;
@@ -53,11 +65,40 @@ namespace daedalus {
 			class ConditionnalExpression;
 			class ConditionnalStructure;
 
+			class LazyScope;
+
+    		/**
+    		 * Check if an expression is a literal known at parse time
+    		 */
+    		bool is_literal(std::shared_ptr<daedalus::core::ast::Expression> expression);
+    		/**
+    		 * Get the truthiness of a literal, following the IsTrue rules of the runtime values
+    		 */
+    		bool literal_is_true(std::shared_ptr<daedalus::core::ast::Expression> expression);
+    		/**
+    		 * Shared true / false literal of the folded expressions, never mutated
+    		 */
+    		std::shared_ptr<daedalus::entropia::ast::BooleanExpression> get_boolean_literal(bool value);
+    		/**
+    		 * Fold every expression of a body and drop the ones following an unconditional break / continue
+    		 */
+    		std::vector<std::shared_ptr<daedalus::core::ast::Expression>> get_constexpr_body(std::vector<std::shared_ptr<daedalus::core::ast::Expression>> body);
+    		/**
+    		 * Check if a top level statement is a hidden declaration of the optimizer, run but not a result of the program
+    		 */
+    		bool is_hidden(std::shared_ptr<daedalus::core::ast::Expression> statement);
+
     		class Identifier : public daedalus::core::ast::Expression {
     		public:
     			Identifier(std::string name);
 
     			std::string get_name();
+    			std::string get_static_type();
+    			void set_static_type(std::string static_type);
+    			/**
+    			 * Value of the hidden declaration of the identifier, shown in its place so the results read as the source
+    			 */
+    			void set_hidden_value(std::shared_ptr<daedalus::core::ast::Expression> hidden_value);
 
     			virtual std::string type() override;
     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
@@ -65,6 +106,8 @@ namespace daedalus {
 
     		protected:
     			std::string name;
+    			std::string staticType;
+    			std::shared_ptr<daedalus::core::ast::Expression> hiddenValue;
     		};
 
     		class AssignationExpression : public daedalus::core::ast::Expression {
@@ -76,6 +119,8 @@ namespace daedalus {
 
     			std::shared_ptr<Identifier> get_identifier();
     			std::shared_ptr<daedalus::core::ast::Expression> get_value();
+    			std::string get_static_type();
+    			void set_static_type(std::string static_type);
 
     			virtual std::string type() override;
     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
@@ -84,14 +129,16 @@ namespace daedalus {
     		protected:
     			std::shared_ptr<Identifier> identifier;
     			std::shared_ptr<daedalus::core::ast::Expression> value;
+    			std::string staticType;
     		};
 
     		class DeclarationExpression : public AssignationExpression {
     		public:
-    			DeclarationExpression(std::shared_ptr<Identifier> identifier, std::shared_ptr<daedalus::core::ast::Expression> value, std::string value_type, bool isMutable);
+    			DeclarationExpression(std::shared_ptr<Identifier> identifier, std::shared_ptr<daedalus::core::ast::Expression> value, std::string value_type, bool isMutable, bool isHidden = false);
 
     			std::string get_value_type();
     			bool get_mutability();
+    			bool get_hidden();
 
     			virtual std::string type() override;
     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
@@ -100,6 +147,8 @@ namespace daedalus {
     		protected:
     			std::string value_type;
     			bool isMutable;
+    			// Declared by the optimizer (common subexpression, loop invariant)
+    			bool isHidden;
     		};
 
     		class BooleanExpression : public daedalus::core::ast::Expression {
@@ -137,13 +186,17 @@ namespace daedalus {
     			StrExpression(std::string value);
 
                 std::string get_value();
+                /**
+                 * Value of the literal, its characters interned once when the node is created
+                 */
+                std::shared_ptr<daedalus::core::values::RuntimeValue> get_runtime_value();
 
     			virtual std::string type() override;
     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
     			virtual std::string repr(int indent = 0) override;
 
             protected:
-    			std::string value;
+    			std::shared_ptr<daedalus::entropia::values::StrValue> value;
     		};
 
     		class ContainerExpression : public daedalus::core::ast::Expression {
@@ -160,6 +213,8 @@ namespace daedalus {
 
     			std::shared_ptr<Expression> get_term();
     			std::string get_operator_symbol();
+    			std::string get_static_type();
+    			void set_static_type(std::string static_type);
 
     			virtual std::shared_ptr<Identifier> get_inner_identifier() override;
 
@@ -170,8 +225,17 @@ namespace daedalus {
     		protected:
     			std::shared_ptr<Expression> term;
     			std::string operator_symbol;
+    			std::string staticType;
     		};
 
+    		/**
+    		 * Operation specialized on the operand types, nullptr when a guard fails
+    		 */
+    		typedef std::shared_ptr<daedalus::core::values::RuntimeValue> (*QuickenedOperation)(
+    			const std::shared_ptr<daedalus::core::values::RuntimeValue>& left,
+    			const std::shared_ptr<daedalus::core::values::RuntimeValue>& right
+    		);
+
     		class BinaryExpression : public ContainerExpression {
     		public:
     			BinaryExpression(
@@ -183,6 +247,17 @@ namespace daedalus {
     			std::shared_ptr<Expression> get_left();
     			std::string get_operator_symbol();
     			std::shared_ptr<Expression> get_right();
+    			std::string get_static_type();
+    			void set_static_type(std::string static_type);
+
+    			/**
+    			 * Set by the interpreter after the first evaluation, dropped for good once a guard fails
+    			 * Concurrent executions may race on it, the operations check their operand types anyway
+    			 */
+    			QuickenedOperation get_quickened_operation();
+    			void quicken(QuickenedOperation quickened_operation);
+    			void deoptimize();
+    			bool is_deoptimized();
 
     			virtual std::shared_ptr<Identifier> get_inner_identifier() override;
 
@@ -194,6 +269,9 @@ namespace daedalus {
     			std::shared_ptr<Expression> left;
     			std::string operator_symbol;
     			std::shared_ptr<Expression> right;
+    			std::string staticType;
+    			std::atomic<QuickenedOperation> quickenedOperation;
+    			std::atomic<bool> isDeoptimized;
 
     		private:
     			std::shared_ptr<Identifier> left_contains_identifier();
@@ -222,12 +300,16 @@ namespace daedalus {
      			);
 
                 std::shared_ptr<OrExpression> get_or_expression();
+                std::string get_static_type();
+                void set_static_type(std::string static_type);
 
      			virtual std::string type() override;
+     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
      			virtual std::string repr(int indent = 0) override;
 
             protected:
                 std::shared_ptr<OrExpression> orExpression;
+                std::string staticType;
             };
 
             class WhileExpression : public LoopExpression {
@@ -241,12 +323,25 @@ namespace daedalus {
                 std::shared_ptr<Expression> get_condition();
 
                 virtual std::string type() override;
+     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
      			virtual std::string repr(int indent = 0) override;
 
             protected:
                 std::shared_ptr<Expression> condition;
             };
 
+            /**
+             * Canonical induction variable of a for loop: for(let mut i: <integer> = ...; i <op> <invariant>; i = i +/- <constant>)
+             */
+            struct CountedLoop {
+                std::string name;
+                std::string comparison;
+                std::shared_ptr<daedalus::core::ast::Expression> bound;
+                double step;
+                // The body reads the variable, which must then be kept in the environment
+                bool isRead;
+            };
+
             class ForExpression : public WhileExpression {
             public:
                 ForExpression(
@@ -260,12 +355,53 @@ namespace daedalus {
                 std::shared_ptr<Expression> get_initial_expression();
                 std::shared_ptr<Expression> get_update_expression();
 
+                /**
+                 * Analyzed once by the interpreter on the first evaluation (from any thread), nullptr when the loop isn't counted
+                 */
+                std::shared_ptr<CountedLoop> get_counted_loop();
+                void analyze_counted_loop(const std::function<std::shared_ptr<CountedLoop>()>& analysis);
+
                 virtual std::string type() override;
+     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
      			virtual std::string repr(int indent = 0) override;
 
             protected:
                 std::shared_ptr<Expression> initialExpression;
                 std::shared_ptr<Expression> updateExpression;
+                std::shared_ptr<CountedLoop> countedLoop;
+                std::once_flag countedLoopAnalysis;
+            };
+
+            /**
+             * Value combined across the iterations of a par for loop, each chunk of iterations starts from the identity of the operator
+             */
+            struct Reduction {
+                std::string name;
+                // + * && ||
+                std::string operator_symbol;
+            };
+
+            /**
+             * Counted for loop whose iterations are split across threads: par for(...) reduce(s: +, ...) { ... }
+             */
+            class ParallelForExpression : public ForExpression {
+            public:
+                ParallelForExpression(
+                    std::vector<std::shared_ptr<Expression>> body,
+                    std::shared_ptr<Expression> initial_expression,
+                    std::shared_ptr<Expression> condition,
+                    std::shared_ptr<Expression> update_expression,
+                    std::vector<Reduction> reductions,
+                    std::shared_ptr<OrExpression> orExpression = nullptr
+                );
+
+                std::vector<Reduction> get_reductions();
+
+                virtual std::string type() override;
+     			virtual std::string repr(int indent = 0) override;
+
+            protected:
+                std::vector<Reduction> reductions;
             };
 
             class BreakExpression : public daedalus::core::ast::Expression {
@@ -298,6 +434,7 @@ namespace daedalus {
                 std::shared_ptr<daedalus::core::ast::Expression> get_condition();
 
      			virtual std::string type() override;
+     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
      			virtual std::string repr(int indent = 0) override;
 
       		protected:
@@ -312,6 +449,8 @@ namespace daedalus {
                 );
 
                 std::vector<std::shared_ptr<ConditionnalExpression>> get_expressions();
+                std::string get_static_type();
+                void set_static_type(std::string static_type);
 
                 virtual std::string type() override;
      			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
@@ -319,6 +458,54 @@ namespace daedalus {
 
             protected:
                 std::vector<std::shared_ptr<ConditionnalExpression>> expressions;
+                std::string staticType;
+            };
+
+            /**
+             * State of the checker where a body was deferred, the body is checked from it once parsed
+             */
+            struct DeferredCheck {
+                // Declared types by scope, the host's values first
+                std::vector<std::unordered_map<std::string, std::string>> scopes;
+                std::unordered_set<std::string> globals;
+                std::unordered_map<std::string, std::string> reductions;
+                size_t parallelScope;
+                size_t parallelLoops;
+            };
+
+            /**
+             * Body kept as its tokens until its first evaluation (lazy parsing)
+             *
+             * The identifier types of the parser are kept as they were where the body was deferred, the body is parsed from them.
+             * Parsed by the thread running the program, without synchronization: --lazy only applies to the thread that set it,
+             * and the par for bodies (run by the pool) are always parsed eagerly.
+             */
+            class LazyScope : public daedalus::core::ast::Scope {
+            public:
+                LazyScope(
+                    std::vector<daedalus::core::lexer::Token> tokens,
+                    daedalus::core::parser::Parser* parser,
+                    std::unordered_map<std::string, std::string> identifiers
+                );
+
+                std::vector<daedalus::core::lexer::Token> get_tokens();
+                daedalus::core::parser::Parser* get_parser();
+                std::unordered_map<std::string, std::string> get_identifiers();
+                daedalus::entropia::ast::DeferredCheck get_deferred_check();
+                void set_deferred_check(daedalus::entropia::ast::DeferredCheck deferred_check);
+                bool is_parsed();
+                void set_body(std::vector<std::shared_ptr<Expression>> body);
+
+                virtual std::string type() override;
+     			virtual std::shared_ptr<daedalus::core::ast::Expression> get_constexpr() override;
+     			virtual std::string repr(int indent = 0) override;
+
+            protected:
+                std::vector<daedalus::core::lexer::Token> tokens;
+                daedalus::core::parser::Parser* parser;
+                std::unordered_map<std::string, std::string> identifiers;
+                daedalus::entropia::ast::DeferredCheck deferredCheck;
+                bool parsed;
             };
     	}
     }
@@ -1,6 +1,8 @@
 #ifndef __DAEDALUS_ENTROPIA_PARSER__
 #define __DAEDALUS_ENTROPIA_PARSER__
 
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
 #include <daedalus/Entropia/parser/ast.hpp>
 
 #include <daedalus/core/parser/parser.hpp>
@@ -22,7 +24,10 @@ char get_char(std::string src);
 namespace daedalus {
     namespace entropia {
     	namespace parser {
-    		extern std::unordered_map<std::string, std::string> identifiers;
+    		// Parsing state of the current thread, programs can be compiled concurrently
+    		extern thread_local std::unordered_map<std::string, std::string> identifiers;
+    		// Keep the scope bodies as tokens until their first evaluation (single threaded runs only)
+    		extern thread_local bool lazyScopes;
 
     		std::shared_ptr<daedalus::core::ast::Expression> parse_identifier(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
@@ -50,12 +55,21 @@ namespace daedalus {
 
     		std::shared_ptr<daedalus::core::ast::Expression> parse_declaration_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
+            std::vector<std::shared_ptr<daedalus::core::ast::Expression>> parse_body(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens);
+
+            void parse_lazy_scope(std::shared_ptr<daedalus::entropia::ast::LazyScope> lazyScope);
+
             std::shared_ptr<daedalus::core::ast::Expression> parse_or_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
             std::shared_ptr<daedalus::core::ast::Expression> parse_loop_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
             std::shared_ptr<daedalus::core::ast::Expression> parse_while_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
+            /**
+             * Parse the optional reduce(<name>: <operator>, ...) of a par for
+             */
+            std::vector<daedalus::entropia::ast::Reduction> parse_reductions(std::vector<daedalus::core::lexer::Token>& tokens);
+
             std::shared_ptr<daedalus::core::ast::Expression> parse_for_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
 
             std::shared_ptr<daedalus::core::ast::Expression> parse_break_expression(daedalus::core::parser::Parser& parser, std::vector<daedalus::core::lexer::Token>& tokens, bool needsSemicolon);
@@ -0,0 +1,152 @@
+#ifndef __DAEDALUS_ENTROPIA_PIPELINE__
+#define __DAEDALUS_ENTROPIA_PIPELINE__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/interpreter.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+#include <daedalus/Entropia/parser/parser.hpp>
+
+#include <daedalus/core/core.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace pipeline {
+
+    		/**
+    		 * Pipelined run of a source (--pipeline), each stage on its own thread:
+    		 *
+    		 * lexer (source segments) -> tokens -> parser (+ checker, optimizer, per top level statement) -> statements -> interpreter
+    		 *
+    		 * A statement runs as soon as it is parsed, before the end of the source is lexed.
+    		 * The errors of a stage are rethrown once the statements before them ran.
+    		 */
+
+    		const size_t TOKEN_QUEUE_CAPACITY = 4096;
+    		const size_t STATEMENT_QUEUE_CAPACITY = 256;
+    		// Source lexed at once, cut at the end of a line
+    		const size_t LEXER_SEGMENT_SIZE = 16 * 1024;
+    		// Failed attempts before a waiting stage yields its core
+    		const size_t SPIN_COUNT = 64;
+
+    		/**
+    		 * Bounded single producer / single consumer ring buffer, lock-free
+    		 *
+    		 * The producer closes it once done, the consumer cancels it when it stops early (the producer then stops pushing).
+    		 */
+    		template<typename T>
+    		class BoundedQueue {
+    		public:
+    			/**
+    			 * The capacity is rounded up to a power of two
+    			 */
+    			BoundedQueue(size_t capacity) :
+    				slots(),
+    				mask(0),
+    				head(0),
+    				tail(0),
+    				closed(false),
+    				cancelled(false)
+    			{
+    				size_t size = 1;
+    				while(size < capacity) {
+    					size *= 2;
+    				}
+    				this->slots = std::vector<T>(size);
+    				this->mask = size - 1;
+    			}
+
+    			BoundedQueue(const BoundedQueue&) = delete;
+    			BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    			/**
+    			 * Wait for a free slot, returns false when the consumer cancelled the queue
+    			 */
+    			bool push(T value) {
+    				size_t tail = this->tail.load(std::memory_order_relaxed);
+    				for(size_t attempt = 0; tail - this->head.load(std::memory_order_acquire) == this->slots.size(); attempt++) {
+    					if(this->cancelled.load(std::memory_order_relaxed)) {
+    						return false;
+    					}
+    					if(attempt >= daedalus::entropia::pipeline::SPIN_COUNT) {
+    						std::this_thread::yield();
+    					}
+    				}
+    				this->slots[tail & this->mask] = std::move(value);
+    				this->tail.store(tail + 1, std::memory_order_release);
+    				return true;
+    			}
+
+    			/**
+    			 * Wait for a value, returns false once the queue is closed and empty
+    			 */
+    			bool pop(T& value) {
+    				size_t head = this->head.load(std::memory_order_relaxed);
+    				for(size_t attempt = 0; head == this->tail.load(std::memory_order_acquire); attempt++) {
+    					// Closed after the last push, so checked before the tail is read again
+    					if(this->closed.load(std::memory_order_acquire) && head == this->tail.load(std::memory_order_acquire)) {
+    						return false;
+    					}
+    					if(attempt >= daedalus::entropia::pipeline::SPIN_COUNT) {
+    						std::this_thread::yield();
+    					}
+    				}
+    				value = std::move(this->slots[head & this->mask]);
+    				this->head.store(head + 1, std::memory_order_release);
+    				return true;
+    			}
+
+    			void close() {
+    				this->closed.store(true, std::memory_order_release);
+    			}
+
+    			void cancel() {
+    				this->cancelled.store(true, std::memory_order_relaxed);
+    			}
+
+    		private:
+    			std::vector<T> slots;
+    			size_t mask;
+    			// Written by the consumer / the producer only, on their own cache lines
+    			alignas(64) std::atomic<size_t> head;
+    			alignas(64) std::atomic<size_t> tail;
+    			std::atomic<bool> closed;
+    			std::atomic<bool> cancelled;
+    		};
+
+    		/**
+    		 * Cut a source at the end of the lines following each segmentSize characters, never inside a char / str literal
+    		 */
+    		std::vector<std::string> split_source(std::string_view src, size_t segmentSize);
+
+    		/**
+    		 * Track the paren / brace depth of a token stream, true when the token is a top level ;
+    		 * Only whole statements are parsed: an if / else is parsed with the statement after it
+    		 */
+    		bool is_statement_end(const daedalus::core::lexer::Token& token, size_t& depth);
+
+    		/**
+    		 * Lex, parse and run a source in a pipeline, onResult being called by the calling thread after each top level statement
+    		 * Gives the program that ran (optimized statement by statement), to be cached
+    		 */
+    		std::shared_ptr<daedalus::core::ast::Scope> run_pipelined(
+    			daedalus::core::Daedalus& daedalusConfig,
+    			std::string_view src,
+    			std::function<void(const daedalus::entropia::interpreter::LazyResult&)> onResult
+    		);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_PIPELINE__
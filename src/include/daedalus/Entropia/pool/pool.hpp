@@ -0,0 +1,61 @@
+#ifndef __DAEDALUS_ENTROPIA_POOL__
+#define __DAEDALUS_ENTROPIA_POOL__
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace pool {
+
+    		/**
+    		 * Threads used by the batch mode and the par for loops (--threads), the hardware concurrency by default
+    		 */
+    		extern size_t threadCount;
+
+    		/**
+    		 * Check if the current thread is a worker of a pool, whose jobs then run their own parallel work inline
+    		 */
+    		bool is_worker_thread();
+
+    		/**
+    		 * Threads running a fixed set of jobs [0, jobCount), waiting for all of them when destroyed
+    		 *
+    		 * Each worker starts with a contiguous block of jobs, taken from the front (input order).
+    		 * Once its queue is empty, it steals from the back of the others.
+    		 */
+    		class WorkStealingPool {
+    		public:
+    			/**
+    			 * The job must not throw
+    			 */
+    			WorkStealingPool(size_t threadCount, size_t jobCount, std::function<void(size_t)> job);
+    			~WorkStealingPool();
+
+    			WorkStealingPool(const WorkStealingPool&) = delete;
+    			WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    		private:
+    			struct WorkerQueue {
+    				std::mutex mutex;
+    				std::deque<size_t> jobs;
+    			};
+
+    			void work(size_t worker);
+    			bool pop(size_t worker, size_t& job);
+    			bool steal(size_t thief, size_t& job);
+
+    			std::function<void(size_t)> job;
+    			std::vector<std::unique_ptr<WorkerQueue>> queues;
+    			std::vector<std::thread> threads;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_POOL__
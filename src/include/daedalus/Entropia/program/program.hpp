@@ -0,0 +1,92 @@
+#ifndef __DAEDALUS_ENTROPIA_PROGRAM__
+#define __DAEDALUS_ENTROPIA_PROGRAM__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/interpreter.hpp>
+#include <daedalus/Entropia/lexer/lexer.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+#include <daedalus/Entropia/parser/parser.hpp>
+
+#include <daedalus/core/core.hpp>
+#include <daedalus/core/interpreter/values.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace program {
+
+    		/**
+    		 * Embedding API: compile a source once, run it many times with the inputs of the host
+    		 *
+    		 * auto program = std::make_shared<const CompiledProgram>(src, std::unordered_map<std::string, std::string>({ { "score", "i32" } }));
+    		 * ExecutionContext context = ExecutionContext(program);
+    		 * context.set_input("score", std::make_shared<daedalus::core::values::NumberValue>(12));
+    		 * std::shared_ptr<daedalus::core::values::RuntimeValue> value = context.run();
+    		 *
+    		 * A compiled program isn't modified by its runs and can be shared by any number of threads, each one running it with its own context.
+    		 */
+
+    		/**
+    		 * Lexer, parser and interpreter configuration, set up on first use and shared by every program
+    		 */
+    		daedalus::core::Daedalus& get_daedalus();
+
+    		/**
+    		 * Check if a runtime value can be bound to an input of the type
+    		 */
+    		bool is_value_of_type(std::shared_ptr<daedalus::core::values::RuntimeValue> value, std::string type);
+
+    		class CompiledProgram {
+    		public:
+    			/**
+    			 * Lex, parse (strict mode), check and optimize a source
+    			 * The inputs are the immutable values provided by the host on each run, by name and type
+    			 */
+    			CompiledProgram(std::string src, std::unordered_map<std::string, std::string> inputTypes = std::unordered_map<std::string, std::string>());
+    			/**
+    			 * Wrap a program already checked and optimized (loaded from the cache), without inputs
+    			 */
+    			CompiledProgram(std::shared_ptr<daedalus::core::ast::Scope> program);
+
+    			std::shared_ptr<daedalus::core::ast::Scope> get_program() const;
+    			const std::unordered_map<std::string, std::string>& get_input_types() const;
+
+    		private:
+    			std::shared_ptr<daedalus::core::ast::Scope> program;
+    			std::unordered_map<std::string, std::string> inputTypes;
+    		};
+
+    		/**
+    		 * Inputs of a compiled program, each run gets a fresh environment (a context is used by one thread at a time)
+    		 */
+    		class ExecutionContext {
+    		public:
+    			ExecutionContext(std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program);
+
+    			/**
+    			 * Bind an input for the next runs, throws when the program doesn't declare it with the type of the value
+    			 */
+    			void set_input(std::string name, std::shared_ptr<daedalus::core::values::RuntimeValue> value);
+
+    			/**
+    			 * Run the program, throws when an input is missing
+    			 * Gives the value of the last statement, the top level results are recorded when results isn't nullptr
+    			 */
+    			std::shared_ptr<daedalus::core::values::RuntimeValue> run(std::vector<daedalus::entropia::interpreter::LazyResult>* results = nullptr);
+
+    		private:
+    			std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program;
+    			std::unordered_map<std::string, std::shared_ptr<daedalus::core::values::RuntimeValue>> inputs;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_PROGRAM__
@@ -0,0 +1,129 @@
+#ifndef __DAEDALUS_ENTROPIA_RECORD__
+#define __DAEDALUS_ENTROPIA_RECORD__
+
+#include <daedalus/Entropia/columnar/columnar.hpp>
+#include <daedalus/Entropia/interpreter/interpreter.hpp>
+#include <daedalus/Entropia/interpreter/region.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/program/program.hpp>
+
+#include <daedalus/core/core.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace record {
+
+    		/**
+    		 * Run a program once per input line (--records), like awk
+    		 *
+    		 * The program is compiled once, with its fields declared as immutable inputs (and the whole line as record when it reads it).
+    		 * Each record is split in place, its fields are rebound in the same environment and its values allocated in one region.
+    		 * With --columnar, the records are read by batches into columns and the columnar version of the program runs once per batch (when it has one).
+    		 * The outcomes are written one per line:
+    		 *
+    		 * <value of the last statement>
+    		 * <record number> !! <error> (on the error output)
+    		 */
+
+    		const size_t READ_BUFFER_SIZE = 64 * 1024;
+    		const size_t OUTPUT_BUFFER_SIZE = 64 * 1024;
+    		const std::string RECORD_NAME = "record";
+
+    		struct Field {
+    			std::string name;
+    			std::string type;
+    		};
+
+    		/**
+    		 * Get the fields of a description <name>:<type>,<name>:<type>,...
+    		 */
+    		std::vector<daedalus::entropia::record::Field> parse_fields(std::string description);
+
+    		/**
+    		 * Cut the fields of a record, throws when it doesn't have exactly count
+    		 */
+    		void split_fields(std::string_view record, char separator, size_t count, std::vector<std::string_view>& fieldTexts);
+
+    		/**
+    		 * Convert the text of a number field, checked against its type (and its range for the integers)
+    		 */
+    		double parse_number(std::string_view text, const std::string& type);
+
+    		/**
+    		 * Convert the text of a field to a value of its type
+    		 */
+    		std::shared_ptr<daedalus::core::values::RuntimeValue> parse_field(std::string_view text, const std::string& type);
+
+    		/**
+    		 * Lines of an input, read by blocks and never copied
+    		 */
+    		class LineReader {
+    		public:
+    			LineReader(std::istream& input);
+
+    			/**
+    			 * Get the next line (without its \n or \r\n), valid until the next call, returns false at the end of the input
+    			 */
+    			bool next(std::string_view& line);
+
+    		private:
+    			std::istream& input;
+    			std::vector<char> buffer;
+    			// Unread part of the buffer
+    			size_t start;
+    			size_t end;
+    			bool isEnd;
+    		};
+
+    		class RecordRunner {
+    		public:
+    			/**
+    			 * Compile a program reading the fields (and record), split by separator
+    			 */
+    			RecordRunner(std::string src, std::vector<daedalus::entropia::record::Field> fields, char separator, bool isColumnar = false);
+
+    			/**
+    			 * Bind the fields of a record and run the program, gives the value of its last statement
+    			 */
+    			std::shared_ptr<daedalus::core::values::RuntimeValue> run(std::string_view record);
+
+    			/**
+    			 * Columnar version of the program, nullptr when it runs record by record
+    			 */
+    			std::shared_ptr<const daedalus::entropia::columnar::ColumnarProgram> get_columnar_program() const;
+
+    			/**
+    			 * Read the fields of a record into a new row of a batch, a row with an invalid field fails
+    			 */
+    			void add_row(daedalus::entropia::columnar::Batch& batch, std::string_view record);
+
+    		private:
+    			std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program;
+    			std::shared_ptr<const daedalus::entropia::columnar::ColumnarProgram> columnarProgram;
+    			std::vector<daedalus::entropia::record::Field> fields;
+    			char separator;
+    			bool isRecordRead;
+    			// Created once, only its values change from a record to the next
+    			std::shared_ptr<daedalus::core::env::Environment> inputEnv;
+    			std::vector<std::string_view> fieldTexts;
+    		};
+
+    		/**
+    		 * Run the program on each line of the input, returns the number of failed records
+    		 */
+    		size_t run_records(daedalus::entropia::record::RecordRunner& runner, std::istream& input, std::ostream& output, std::ostream& errors);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_RECORD__
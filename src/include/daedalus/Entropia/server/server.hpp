@@ -0,0 +1,123 @@
+#ifndef __DAEDALUS_ENTROPIA_SERVER__
+#define __DAEDALUS_ENTROPIA_SERVER__
+
+#include <daedalus/Entropia/cache/cache.hpp>
+#include <daedalus/Entropia/interpreter/values.hpp>
+#include <daedalus/Entropia/program/program.hpp>
+
+#include <daedalus/core/interpreter/interpreter.hpp>
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace server {
+
+    		/**
+    		 * Warm daemon on a Unix domain socket (--serve) and its client (--connect)
+    		 *
+    		 * The daemon sets up the configuration once and keeps the compiled programs by source hash, a request only pays for its run.
+    		 * Each message is a header followed by size bytes:
+    		 *
+    		 * client -> RUN <source>        daemon -> VALUE <top level results and value of the last statement> | FAILURE <error>
+    		 * client -> STOP                daemon -> VALUE (then stops accepting and ends the other connections once idle)
+    		 *
+    		 * A connection can send any number of requests, each one answered before the next is read.
+    		 * The connections are served by --threads threads, the programs are compiled one at a time and run concurrently.
+    		 */
+
+    		const size_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+    		const size_t PROGRAM_CACHE_CAPACITY = 256;
+
+    		enum class MessageKind : uint32_t {
+    			RUN,
+    			STOP,
+    			VALUE,
+    			FAILURE
+    		};
+
+    		struct MessageHeader {
+    			daedalus::entropia::server::MessageKind kind;
+    			uint32_t size;
+    		};
+
+    		/**
+    		 * Compiled programs by source hash, the least recently used one is dropped past the capacity
+    		 */
+    		class ProgramCache {
+    		public:
+    			ProgramCache(size_t capacity = daedalus::entropia::server::PROGRAM_CACHE_CAPACITY);
+
+    			/**
+    			 * Get the compiled program of a source, compiled on a miss (throws on a compilation error, which isn't kept)
+    			 */
+    			std::shared_ptr<const daedalus::entropia::program::CompiledProgram> get_program(const std::string& src);
+
+    			size_t get_size();
+
+    		private:
+    			struct CacheEntry {
+    				// Compared on a hit, two sources can share a hash
+    				std::string src;
+    				std::shared_ptr<const daedalus::entropia::program::CompiledProgram> program;
+    				std::list<uint64_t>::iterator use;
+    			};
+
+    			size_t capacity;
+    			std::mutex mutex;
+    			std::unordered_map<uint64_t, CacheEntry> entries;
+    			// Most recently used first
+    			std::list<uint64_t> uses;
+    		};
+
+    		/**
+    		 * Run a source with the cached programs, gives the text of the VALUE answer (the errors are thrown)
+    		 */
+    		std::string run_request(daedalus::entropia::server::ProgramCache& programCache, const std::string& src, bool recordResults);
+
+    		/**
+    		 * Listen on socketPath and serve the requests on threadCount threads until a STOP request, throws when a daemon already listens on it
+    		 */
+    		void serve(std::string socketPath, size_t threadCount, bool recordResults);
+
+    		/**
+    		 * Connection to a daemon, used by one thread at a time
+    		 */
+    		class Client {
+    		public:
+    			/**
+    			 * Connect to the daemon listening on socketPath, throws when there is none
+    			 */
+    			Client(std::string socketPath);
+    			~Client();
+
+    			Client(const Client&) = delete;
+    			Client& operator=(const Client&) = delete;
+
+    			/**
+    			 * Run a source on the daemon, returns false when it failed (output then holds its error)
+    			 */
+    			bool run(std::string_view src, std::string& output);
+
+    			/**
+    			 * Stop the daemon once its current requests are answered
+    			 */
+    			void stop();
+
+    		private:
+    			int socket;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_SERVER__
@@ -0,0 +1,52 @@
+#ifndef __DAEDALUS_ENTROPIA_SOURCE__
+#define __DAEDALUS_ENTROPIA_SOURCE__
+
+#include <daedalus/core/tools/assert.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace source {
+
+    		const size_t READ_BLOCK_SIZE = 64 * 1024;
+
+    		/**
+    		 * Source file mapped in memory, read through a view of the mapping
+    		 *
+    		 * The view is enough to hash a source and load its cached program, the source is only copied (at once) to be lexed.
+    		 * The files that can't be mapped (empty, pipes, non POSIX systems) are read into a buffer, of their exact size when it is known.
+    		 */
+    		class SourceFile {
+    		public:
+    			/**
+    			 * Map a file, throws when it can't be opened
+    			 */
+    			SourceFile(std::string path);
+    			~SourceFile();
+
+    			SourceFile(const SourceFile&) = delete;
+    			SourceFile& operator=(const SourceFile&) = delete;
+
+    			/**
+    			 * Content of the file, valid as long as the source file
+    			 */
+    			std::string_view get_view() const;
+
+    			std::string to_string() const;
+
+    		private:
+    			const char* data;
+    			size_t size;
+    			bool isMapped;
+    			// Content of a file read instead of mapped
+    			std::string buffer;
+    		};
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_SOURCE__
@@ -0,0 +1,135 @@
+#ifndef __DAEDALUS_ENTROPIA_STATS__
+#define __DAEDALUS_ENTROPIA_STATS__
+
+#include <daedalus/Entropia/parser/ast.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace stats {
+
+    		/**
+    		 * Performance report of a run (--stats / --stats-json), written on the error output
+    		 *
+    		 * Each phase is timed in wall and CPU time (of every thread of the process).
+    		 * The counters only cost a branch when the stats are off: the statements run by the interpreter (not the ones of JIT or native code), the values (make_value) and environments it allocates.
+    		 * collectStats is only set before running.
+    		 */
+
+    		extern bool collectStats;
+    		extern std::atomic<size_t> statementCount;
+    		extern std::atomic<size_t> allocationCount;
+
+    		inline void count_statement() {
+    			if(daedalus::entropia::stats::collectStats) {
+    				daedalus::entropia::stats::statementCount.fetch_add(1, std::memory_order_relaxed);
+    			}
+    		}
+
+    		inline void count_allocation() {
+    			if(daedalus::entropia::stats::collectStats) {
+    				daedalus::entropia::stats::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    			}
+    		}
+
+    		/**
+    		 * Heap allocator counting its allocations, for the objects of the interpreter not made by make_value
+    		 */
+    		template<typename T>
+    		class CountingAllocator {
+    		public:
+    			typedef T value_type;
+
+    			CountingAllocator() {}
+
+    			template<typename U>
+    			CountingAllocator(const CountingAllocator<U>&) {}
+
+    			T* allocate(size_t count) {
+    				daedalus::entropia::stats::count_allocation();
+    				return std::allocator<T>().allocate(count);
+    			}
+
+    			void deallocate(T* pointer, size_t count) {
+    				std::allocator<T>().deallocate(pointer, count);
+    			}
+
+    			template<typename U>
+    			bool operator==(const CountingAllocator<U>&) const {
+    				return true;
+    			}
+    			template<typename U>
+    			bool operator!=(const CountingAllocator<U>&) const {
+    				return false;
+    			}
+    		};
+
+    		struct PhaseTime {
+    			std::string name;
+    			double wallMs;
+    			double cpuMs;
+    		};
+
+    		struct Report {
+    			// In the order they ended
+    			std::vector<daedalus::entropia::stats::PhaseTime> phases;
+    			size_t tokenCount;
+    			size_t nodeCount;
+    			bool isCached;
+    		};
+
+    		/**
+    		 * Time a phase until stopped or destroyed
+    		 */
+    		class PhaseTimer {
+    		public:
+    			PhaseTimer(daedalus::entropia::stats::Report& report, std::string name);
+    			~PhaseTimer();
+
+    			/**
+    			 * Add the phase to the report, only the first call does
+    			 */
+    			void stop();
+
+    			PhaseTimer(const PhaseTimer&) = delete;
+    			PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+    		private:
+    			daedalus::entropia::stats::Report& report;
+    			std::string name;
+    			std::chrono::steady_clock::time_point wallStart;
+    			std::clock_t cpuStart;
+    			bool isStopped;
+    		};
+
+    		/**
+    		 * Count the nodes of a program, the tokens of a lazy scope not parsed yet aren't counted
+    		 */
+    		size_t count_nodes(std::shared_ptr<daedalus::core::ast::Expression> expression);
+
+    		/**
+    		 * Peak resident set size of the process in KiB, 0 when unknown
+    		 */
+    		size_t get_peak_rss();
+
+    		/**
+    		 * Human readable report, one phase or counter per line
+    		 */
+    		std::string format_report(const daedalus::entropia::stats::Report& report);
+
+    		/**
+    		 * Report as a single line JSON object
+    		 */
+    		std::string format_json(const daedalus::entropia::stats::Report& report);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_STATS__
@@ -0,0 +1,42 @@
+#ifndef __DAEDALUS_ENTROPIA_STREAM__
+#define __DAEDALUS_ENTROPIA_STREAM__
+
+#include <daedalus/Entropia/checker/checker.hpp>
+#include <daedalus/Entropia/interpreter/interpreter.hpp>
+#include <daedalus/Entropia/optimizer/optimizer.hpp>
+#include <daedalus/Entropia/pipeline/pipeline.hpp>
+
+#include <daedalus/core/core.hpp>
+
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace daedalus {
+    namespace entropia {
+    	namespace stream {
+
+    		/**
+    		 * Streamed run of a source (--stream), on the calling thread:
+    		 *
+    		 * read a block -> lex its whole lines -> parse, check, optimize and run each top level statement -> free it
+    		 *
+    		 * Only the environment (and the declared types of the checker) outlives a statement.
+    		 * The memory used doesn't depend on the size of the source, only on its largest statement.
+    		 */
+
+    		/**
+    		 * Run a source read from input, onResult being called after each top level statement (the statement is freed once it returns)
+    		 */
+    		void run_streamed(
+    			daedalus::core::Daedalus& daedalusConfig,
+    			std::istream& input,
+    			std::function<void(const daedalus::entropia::interpreter::LazyResult&)> onResult
+    		);
+    	}
+    }
+}
+
+#endif // __DAEDALUS_ENTROPIA_STREAM__
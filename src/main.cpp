@@ -2,77 +2,475 @@
 
 #include <daedalus/core/core.hpp>
 
+#include <cstdlib>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
+#include <iostream>
 #include <string>
 #include <vector>
 
+static const std::string USAGE =
+	"Usage: tlang [--lazy | --strict] [--jit] [--threads <count>] [--native | --compile <output> | --pipeline | --stream] [--stats | --stats-json] <filename>\n"
+	"       tlang [--jit] [--threads <count>] --batch <filename>... | --manifest <manifest>\n"
+	"       tlang [--jit] --records [--columnar] [--fields <name>:<type>,...] [--separator <char>] <filename> [<input>]\n"
+	"       tlang [--jit] [--threads <count>] --serve <socket>\n"
+	"       tlang --connect <socket> <filename> | --stop";
+
 int main(int argc, char** argv) {
 
+	std::string filename = "";
+	bool native = false;
+	std::string compileOutput = "";
+	bool pipeline = false;
+	bool stream = false;
+	bool batch = false;
+	auto batchFilenames = std::vector<std::string>();
+	bool records = false;
+	bool columnar = false;
+	auto fields = std::vector<daedalus::entropia::record::Field>();
+	char separator = ',';
+	std::string recordsFilename = "";
+	std::string serveSocket = "";
+	std::string connectSocket = "";
+	bool stop = false;
+	bool stats = false;
+	bool statsJson = false;
+
+	for(int i = 1; i < argc; i++) {
+		std::string argument = argv[i];
+		if(argument == "--lazy") {
+			daedalus::entropia::parser::lazyScopes = true;
+		} else if(argument == "--strict") {
+			daedalus::entropia::parser::lazyScopes = false;
+		} else if(argument == "--jit") {
+			daedalus::entropia::jit::jitLoops = true;
+		} else if(argument == "--native") {
+			native = true;
+		} else if(argument == "--compile") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc,
+				std::runtime_error("Missing output\n" + USAGE)
+			)
+			compileOutput = argv[++i];
+		} else if(argument == "--pipeline") {
+			pipeline = true;
+		} else if(argument == "--stream") {
+			stream = true;
+		} else if(argument == "--batch") {
+			batch = true;
+		} else if(argument == "--manifest") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc,
+				std::runtime_error("Missing manifest\n" + USAGE)
+			)
+			batch = true;
+			for(const std::string& batchFilename : daedalus::entropia::batch::read_manifest(argv[++i])) {
+				batchFilenames.push_back(batchFilename);
+			}
+		} else if(argument == "--threads") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc && std::atoi(argv[i + 1]) > 0,
+				std::runtime_error("Invalid thread count\n" + USAGE)
+			)
+			daedalus::entropia::pool::threadCount = std::atoi(argv[++i]);
+		} else if(argument == "--records") {
+			records = true;
+		} else if(argument == "--columnar") {
+			columnar = true;
+		} else if(argument == "--fields") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc,
+				std::runtime_error("Missing fields\n" + USAGE)
+			)
+			fields = daedalus::entropia::record::parse_fields(argv[++i]);
+		} else if(argument == "--separator") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc && std::string(argv[i + 1]).size() == 1,
+				std::runtime_error("Invalid separator\n" + USAGE)
+			)
+			separator = argv[++i][0];
+		} else if(argument == "--serve") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc,
+				std::runtime_error("Missing socket\n" + USAGE)
+			)
+			serveSocket = argv[++i];
+		} else if(argument == "--connect") {
+			DAE_ASSERT_TRUE(
+				i + 1 < argc,
+				std::runtime_error("Missing socket\n" + USAGE)
+			)
+			connectSocket = argv[++i];
+		} else if(argument == "--stop") {
+			stop = true;
+		} else if(argument == "--stats") {
+			stats = true;
+		} else if(argument == "--stats-json") {
+			stats = true;
+			statsJson = true;
+		} else if(batch) {
+			batchFilenames.push_back(argument);
+		} else if(records && !filename.empty() && recordsFilename.empty()) {
+			recordsFilename = argument;
+		} else {
+			DAE_ASSERT_TRUE(
+				filename.empty(),
+				std::runtime_error("Invalid number of arguments\n" + USAGE)
+			)
+			filename = argument;
+		}
+	}
+
+	// The phases are only those of a single program compiled and run in order
+	DAE_ASSERT_TRUE(
+		!stats || (compileOutput.empty() && !pipeline && !stream && !batch && !records && serveSocket.empty() && connectSocket.empty()),
+		std::runtime_error("--stats can't be used with --compile, --pipeline, --stream, --batch, --records, --serve or --connect")
+	)
+	daedalus::entropia::stats::collectStats = stats;
+
+	// * SERVER
+
+	bool isServerMode = !serveSocket.empty() || !connectSocket.empty();
+	DAE_ASSERT_TRUE(
+		!isServerMode || (!native && compileOutput.empty() && !pipeline && !stream && !batch && !records),
+		std::runtime_error("--serve and --connect can't be used with --native, --compile, --pipeline, --stream, --batch or --records")
+	)
+	DAE_ASSERT_TRUE(
+		!stop || !connectSocket.empty(),
+		std::runtime_error("--stop can only be used with --connect")
+	)
+
+	if(!serveSocket.empty()) {
+		DAE_ASSERT_TRUE(
+			connectSocket.empty() && filename.empty(),
+			std::runtime_error("Invalid number of arguments\n" + USAGE)
+		)
+
+		// Like the batch, only the debug builds send back the top level results
+		bool recordResults = false;
+		DAE_DEBUG({
+			recordResults = true;
+		})
+
+		daedalus::entropia::server::serve(serveSocket, daedalus::entropia::pool::threadCount, recordResults);
+		return 0;
+	}
+
+	// The client only sends the file, the daemon is already set up
+	if(!connectSocket.empty()) {
+		daedalus::entropia::server::Client client = daedalus::entropia::server::Client(connectSocket);
+		if(stop) {
+			DAE_ASSERT_TRUE(
+				filename.empty(),
+				std::runtime_error("Invalid number of arguments\n" + USAGE)
+			)
+			client.stop();
+			return 0;
+		}
+
+		DAE_ASSERT_TRUE(
+			!filename.empty(),
+			std::runtime_error("Invalid number of arguments\n" + USAGE)
+		)
+		DAE_ASSERT_TRUE(
+			(&filename)->rfind(".ent") != std::string::npos,
+			std::runtime_error("Invalid file format")
+		)
+		daedalus::entropia::source::SourceFile source = daedalus::entropia::source::SourceFile(filename);
+
+		std::string output = "";
+		if(!client.run(source.get_view(), output)) {
+			std::cerr << filename << " !! " << output << std::endl;
+			return 1;
+		}
+		std::cout << output << std::endl;
+		return 0;
+	}
+
+	// * BATCH
+
+	if(batch) {
+		DAE_ASSERT_TRUE(
+			filename.empty() && !batchFilenames.empty(),
+			std::runtime_error("Invalid number of arguments\n" + USAGE)
+		)
+		// Every file is parsed strictly, the lazy scopes aren't shared between threads
+		DAE_ASSERT_TRUE(
+			!native && compileOutput.empty() && !pipeline && !stream && !records && !daedalus::entropia::parser::lazyScopes,
+			std::runtime_error("--batch can't be used with --native, --compile, --pipeline, --stream, --records or --lazy")
+		)
+
+		bool recordResults = false;
+		DAE_DEBUG({
+			recordResults = true;
+		})
+
+		size_t failures = daedalus::entropia::batch::run_batch(batchFilenames, daedalus::entropia::pool::threadCount, recordResults, std::cout);
+		return failures == 0 ? 0 : 1;
+	}
+
+	DAE_ASSERT_TRUE(
+		!filename.empty(),
+		std::runtime_error("Invalid number of arguments\n" + USAGE)
+	)
+
+	// * RECORDS
+
+	DAE_ASSERT_TRUE(
+		records || !columnar,
+		std::runtime_error("--columnar can only be used with --records")
+	)
+
+	if(records) {
+		DAE_ASSERT_TRUE(
+			!native && compileOutput.empty() && !pipeline && !stream,
+			std::runtime_error("--records can't be used with --native, --compile, --pipeline or --stream")
+		)
+		DAE_ASSERT_TRUE(
+			(&filename)->rfind(".ent") != std::string::npos,
+			std::runtime_error("Invalid file format")
+		)
+
+		daedalus::entropia::record::RecordRunner runner = daedalus::entropia::record::RecordRunner(
+			daedalus::entropia::source::SourceFile(filename).to_string(),
+			fields,
+			separator,
+			columnar
+		);
+
+		// Read and written by blocks, never synchronized with stdio
+		std::ios::sync_with_stdio(false);
+		size_t failures = 0;
+		if(recordsFilename.empty()) {
+			failures = daedalus::entropia::record::run_records(runner, std::cin, std::cout, std::cerr);
+		} else {
+			std::ifstream input = std::ifstream(recordsFilename, std::ios::binary);
+			DAE_ASSERT_TRUE(
+				input.is_open(),
+				std::runtime_error("Can't open the records " + recordsFilename)
+			)
+			failures = daedalus::entropia::record::run_records(runner, input, std::cout, std::cerr);
+		}
+		return failures == 0 ? 0 : 1;
+	}
+
+	// The native backend needs the whole program parsed
 	DAE_ASSERT_TRUE(
-		argc == 2,
-		std::runtime_error("Invalid number of arguments\nUsage: tlang <filename>: ")
+		!(native || !compileOutput.empty()) || !daedalus::entropia::parser::lazyScopes,
+		std::runtime_error("--native and --compile can't be used with --lazy")
 	)
 
-	std::string filename = argv[1];
+	// The pipeline runs the statements as they are parsed, by its parser thread only
+	DAE_ASSERT_TRUE(
+		!pipeline || (!native && compileOutput.empty() && !daedalus::entropia::parser::lazyScopes),
+		std::runtime_error("--pipeline can't be used with --native, --compile or --lazy")
+	)
+
+	// The streamed statements are freed once they ran, there is no program to compile or cache
+	DAE_ASSERT_TRUE(
+		!stream || (!native && compileOutput.empty() && !pipeline),
+		std::runtime_error("--stream can't be used with --native, --compile or --pipeline")
+	)
 
 	DAE_ASSERT_TRUE(
 		(&filename)->rfind(".ent") != std::string::npos,
 		std::runtime_error("Invalid file format")
 	)
 
-	std::ifstream file = std::ifstream(argv[1]);
-	std::string src = std::string(
-		(std::istreambuf_iterator<char>(file)),
-		std::istreambuf_iterator<char>()
-	);
+	// * STREAM
 
-	daedalus::core::Daedalus daedalusConfig = daedalus::core::setup_daedalus(
-		&setup_lexer,
-		&setup_parser,
-		&setup_interpreter
-	);
+	// Never read as a whole
+	if(stream) {
+		std::ifstream file = std::ifstream(filename);
+		DAE_ASSERT_TRUE(
+			file.is_open(),
+			std::runtime_error("Can't open the file")
+		)
+		daedalus::entropia::stream::run_streamed(
+			daedalus::entropia::program::get_daedalus(),
+			file,
+			[](const daedalus::entropia::interpreter::LazyResult& lazyResult) {
+				// Formatted before the statement is freed
+				DAE_DEBUG({
+					daedalus::core::interpreter::RuntimeResult result = lazyResult.get();
+					DAE_DEBUG_LOG(result.first + " -> " + result.second);
+				})
+			}
+		);
+		return 0;
+	}
 
-	// * LEXER
+	// Timed even without --stats, it's only printed with it
+	daedalus::entropia::stats::Report report = daedalus::entropia::stats::Report();
 
-	std::vector<daedalus::core::lexer::Token> tokens;
+	daedalus::entropia::stats::PhaseTimer setupTimer = daedalus::entropia::stats::PhaseTimer(report, "setup");
+	daedalus::core::Daedalus& daedalusConfig = daedalus::entropia::program::get_daedalus();
+	setupTimer.stop();
 
-	DAE_DEBUG_LOG(src)
+	daedalus::entropia::stats::PhaseTimer loadTimer = daedalus::entropia::stats::PhaseTimer(report, "load");
 
-	daedalus::core::lexer::lex(
-		daedalusConfig.lexer,
-		tokens,
-		src
-	);
+	// Mapped, a cached program is loaded without copying its source
+	daedalus::entropia::source::SourceFile source = daedalus::entropia::source::SourceFile(filename);
 
-	DAE_DEBUG({
-	    for(const daedalus::core::lexer::Token& token : tokens) {
-			DAE_DEBUG_LOG(repr(token))
+	// * CACHE
+
+	bool useCache = daedalus::entropia::cache::is_cache_enabled();
+	uint64_t sourceHash = daedalus::entropia::cache::hash_source(source.get_view());
+	std::string cachePath = daedalus::entropia::cache::get_cache_path(filename, sourceHash);
+
+	std::shared_ptr<daedalus::core::ast::Scope> program = useCache ?
+		daedalus::entropia::cache::load_program(cachePath, sourceHash) :
+		nullptr;
+	report.isCached = program != nullptr;
+	loadTimer.stop();
+
+	// * PIPELINE
+
+	// A cached program is already parsed, it runs as usual
+	if(pipeline && program == nullptr) {
+		program = daedalus::entropia::pipeline::run_pipelined(
+			daedalusConfig,
+			source.get_view(),
+			[](const daedalus::entropia::interpreter::LazyResult& lazyResult) {
+				// Printed as soon as the statement ran
+				DAE_DEBUG({
+					daedalus::core::interpreter::RuntimeResult result = lazyResult.get();
+					DAE_DEBUG_LOG(result.first + " -> " + result.second);
+				})
+			}
+		);
+
+		if(useCache) {
+			try {
+				daedalus::entropia::cache::save_program(cachePath, sourceHash, program);
+			} catch(const std::exception& error) {
+				DAE_DEBUG_LOG(std::string("CACHE ") + error.what())
+			}
 		}
-	})
+		return 0;
+	}
+
+	if(program != nullptr) {
+		DAE_DEBUG_LOG("CACHED PROGRAM " + program->repr())
+	} else {
+
+		// * LEXER
+
+		std::vector<daedalus::core::lexer::Token> tokens;
+		// The only copy of the source, handed to the lexer
+		std::string src = source.to_string();
+
+		DAE_DEBUG_LOG(src)
+
+		daedalus::entropia::stats::PhaseTimer lexTimer = daedalus::entropia::stats::PhaseTimer(report, "lex");
+		daedalus::core::lexer::lex(
+			daedalusConfig.lexer,
+			tokens,
+			src
+		);
+		lexTimer.stop();
+		// Before the parser consumes them
+		report.tokenCount = tokens.size();
+
+		DAE_DEBUG({
+		    for(const daedalus::core::lexer::Token& token : tokens) {
+				DAE_DEBUG_LOG(repr(token))
+			}
+		})
 
-	// * PARSER
+		// * PARSER
 
-	std::shared_ptr<daedalus::core::ast::Scope> program = std::make_shared<daedalus::core::ast::Scope>();
+		program = std::make_shared<daedalus::core::ast::Scope>();
 
-	daedalus::core::parser::parse(
-		daedalusConfig.parser,
-		program,
-		tokens
-	);
+		daedalus::entropia::stats::PhaseTimer parseTimer = daedalus::entropia::stats::PhaseTimer(report, "parse");
+		daedalus::core::parser::parse(
+			daedalusConfig.parser,
+			program,
+			tokens
+		);
+		parseTimer.stop();
 
-	DAE_DEBUG_LOG("PROGRAM " + program->repr())
+		DAE_DEBUG_LOG("PROGRAM " + program->repr())
 
-	// * INTERPRETER
+		// * CHECKER
+
+		daedalus::entropia::stats::PhaseTimer checkTimer = daedalus::entropia::stats::PhaseTimer(report, "check");
+		daedalus::entropia::checker::TypeChecker().check(program);
+		checkTimer.stop();
+
+		// * OPTIMIZER
+
+		daedalus::entropia::stats::PhaseTimer optimizeTimer = daedalus::entropia::stats::PhaseTimer(report, "optimize");
+		program = daedalus::entropia::optimizer::optimize(program);
+		optimizeTimer.stop();
+
+		DAE_DEBUG_LOG("OPTIMIZED PROGRAM " + program->repr())
+
+		// A lazy program still holds unparsed tokens
+		if(useCache && !daedalus::entropia::parser::lazyScopes) {
+			daedalus::entropia::stats::PhaseTimer saveTimer = daedalus::entropia::stats::PhaseTimer(report, "save");
+			try {
+				daedalus::entropia::cache::save_program(cachePath, sourceHash, program);
+			} catch(const std::exception& error) {
+				// A missing cache only costs the next run a parse
+				DAE_DEBUG_LOG(std::string("CACHE ") + error.what())
+			}
+		}
+	}
+
+	// * NATIVE
+
+	if(!compileOutput.empty()) {
+		daedalus::entropia::compiler::build(
+			daedalus::entropia::compiler::SourceGenerator().generate(program, sourceHash),
+			compileOutput,
+			daedalus::entropia::compiler::BuildKind::EXECUTABLE
+		);
+		return 0;
+	}
 
 	std::vector<daedalus::core::interpreter::RuntimeResult> results;
 
-	daedalus::core::interpreter::interpret(
-		daedalusConfig.interpreter,
-		results,
-		program
-	);
+	daedalus::entropia::stats::PhaseTimer runTimer = daedalus::entropia::stats::PhaseTimer(report, native ? "native" : "interpret");
+
+	if(native) {
+		std::string libraryPath = daedalus::entropia::compiler::get_library_path(cachePath);
+
+		// Rebuilt when missing or built from another source
+		if(!daedalus::entropia::compiler::run_library(libraryPath, sourceHash, program, results)) {
+			daedalus::entropia::compiler::build(
+				daedalus::entropia::compiler::SourceGenerator().generate(program, sourceHash),
+				libraryPath,
+				daedalus::entropia::compiler::BuildKind::SHARED_OBJECT
+			);
+			DAE_ASSERT_TRUE(
+				daedalus::entropia::compiler::run_library(libraryPath, sourceHash, program, results),
+				std::runtime_error("Failed to load the native program " + libraryPath)
+			)
+		}
+	} else {
+
+		// * INTERPRETER
+
+		// Only the debug builds print the results, formatted once the program is over
+		bool recordResults = false;
+		DAE_DEBUG({
+			recordResults = true;
+		})
+
+		auto lazyResults = std::vector<daedalus::entropia::interpreter::LazyResult>();
+		daedalus::entropia::interpreter::interpret(
+			daedalusConfig.interpreter,
+			program,
+			recordResults ? &lazyResults : nullptr
+		);
+
+		for(const daedalus::entropia::interpreter::LazyResult& lazyResult : lazyResults) {
+			results.push_back(lazyResult.get());
+		}
+	}
+	runTimer.stop();
 
 	DAE_DEBUG({
     	for(const auto& [node, result] : results) {
@@ -80,5 +478,13 @@ int main(int argc, char** argv) {
     	}
 	})
 
+	// * STATS
+
+	// Counted once the program ran, with the lazy scopes it parsed
+	if(stats) {
+		report.nodeCount = daedalus::entropia::stats::count_nodes(program);
+		std::cerr << (statsJson ? daedalus::entropia::stats::format_json(report) : daedalus::entropia::stats::format_report(report)) << std::endl;
+	}
+
 	return 0;
 }